@@ -0,0 +1,218 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Benchmarks;
+
+use Aashan\Phpanim\Raylib;
+use FFI\CData;
+
+/**
+ * Raylib without a library behind it: only the types from lib/raylib.h are
+ * declared, and every function call is counted instead of executed. Lets the
+ * benchmarks run without a window or GPU.
+ */
+final class StubRaylib extends Raylib
+{
+    /** @var array<string, int> Calls by function name */
+    public array $calls = [];
+
+    /** @var string[]|null Every call in order, only kept when set to an array */
+    public ?array $log = null;
+
+    // Returned by GetTime(), advanced by hand
+    public float $time = 0.0;
+
+    /** @var array<string, bool> Whether a function flushes the draw list, by name */
+    private array $flushes = [];
+
+    public function __construct(
+        public int $width = 1600,
+        public int $height = 900,
+    ) {
+        // Function declarations would have to be resolved from a library, keep the types only
+        parent::__construct(null, Raylib::typesOnly(file_get_contents(__DIR__ . '/../lib/raylib.h')));
+    }
+
+    public function totalCalls(): int
+    {
+        return array_sum($this->calls);
+    }
+
+    public function __call(string $name, array $arguments): mixed
+    {
+        $this->record($name);
+
+        return null;
+    }
+
+    public function GetScreenWidth(): int
+    {
+        $this->record('GetScreenWidth');
+        return $this->width;
+    }
+
+    public function GetScreenHeight(): int
+    {
+        $this->record('GetScreenHeight');
+        return $this->height;
+    }
+
+    public function GetTime(): float
+    {
+        $this->record('GetTime');
+        return $this->time;
+    }
+
+    public function GetFrameTime(): float
+    {
+        $this->record('GetFrameTime');
+        return 1.0 / 60.0;
+    }
+
+    public function GetFPS(): int
+    {
+        $this->record('GetFPS');
+        return 60;
+    }
+
+    public function GetColor(int|float $hexValue): CData
+    {
+        $this->record('GetColor');
+        $hexValue = (int) $hexValue;
+
+        return $this->struct('Color', [
+            'r' => ($hexValue >> 24) & 0xFF,
+            'g' => ($hexValue >> 16) & 0xFF,
+            'b' => ($hexValue >> 8) & 0xFF,
+            'a' => $hexValue & 0xFF,
+        ]);
+    }
+
+    public function MeasureText(CData|string|null $text, int|float $fontSize): int
+    {
+        $this->record('MeasureText');
+        return is_string($text) ? intdiv(strlen($text) * (int) $fontSize, 2) : 0;
+    }
+
+    public function GetFontDefault(): CData
+    {
+        $this->record('GetFontDefault');
+
+        $font = $this->struct('Font');
+        $font->baseSize = 10;
+
+        return $font;
+    }
+
+    public function MeasureTextEx(CData $font, CData|string|null $text, float $fontSize, float $spacing): CData
+    {
+        $this->record('MeasureTextEx');
+        return $this->struct('Vector2', ['x' => is_string($text) ? strlen($text) * ($fontSize / 2 + $spacing) : 0.0, 'y' => $fontSize]);
+    }
+
+    public function LoadRenderTexture(int|float $width, int|float $height): CData
+    {
+        $this->record('LoadRenderTexture');
+
+        $target = $this->struct('RenderTexture');
+        $target->texture->width = (int) $width;
+        $target->texture->height = (int) $height;
+
+        return $target;
+    }
+
+    public function UnloadRenderTexture(CData $target): void
+    {
+        $this->record('UnloadRenderTexture');
+    }
+
+    public function DrawLine(int|float $startPosX, int|float $startPosY, int|float $endPosX, int|float $endPosY, CData $color): void
+    {
+        $this->record('DrawLine');
+    }
+
+    public function DrawLineEx(CData $startPos, CData $endPos, float $thick, CData $color): void
+    {
+        $this->record('DrawLineEx');
+    }
+
+    public function DrawText(CData|string|null $text, int|float $posX, int|float $posY, int|float $fontSize, CData $color): void
+    {
+        $this->record('DrawText');
+    }
+
+    public function DrawTextEx(CData $font, CData|string|null $text, CData $position, float $fontSize, float $spacing, CData $tint): void
+    {
+        $this->record('DrawTextEx');
+    }
+
+    public function DrawTextureRec(CData $texture, CData $source, CData $position, CData $tint): void
+    {
+        $this->record('DrawTextureRec');
+    }
+
+    public function DrawRectangle(int|float $posX, int|float $posY, int|float $width, int|float $height, CData $color): void
+    {
+        $this->record('DrawRectangle');
+    }
+
+    public function DrawCircle(int|float $centerX, int|float $centerY, float $radius, CData $color): void
+    {
+        $this->record('DrawCircle');
+    }
+
+    public function DrawTriangle(CData $v1, CData $v2, CData $v3, CData $color): void
+    {
+        $this->record('DrawTriangle');
+    }
+
+    public function DrawSplineLinear(?CData $points, int|float $pointCount, float $thick, CData $color): void
+    {
+        $this->record('DrawSplineLinear');
+    }
+
+    public function DrawSplineCatmullRom(?CData $points, int|float $pointCount, float $thick, CData $color): void
+    {
+        $this->record('DrawSplineCatmullRom');
+    }
+
+    public function ClearBackground(CData $color): void
+    {
+        $this->record('ClearBackground');
+    }
+
+    public function BeginTextureMode(CData $target): void
+    {
+        $this->record('BeginTextureMode');
+    }
+
+    public function EndTextureMode(): void
+    {
+        $this->record('EndTextureMode');
+    }
+
+    public function BeginDrawing(): void
+    {
+        $this->record('BeginDrawing');
+    }
+
+    public function EndDrawing(): void
+    {
+        $this->record('EndDrawing');
+    }
+
+    private function record(string $name): void
+    {
+        // The overrides replace the generated methods, flush where they would
+        if ($this->flushes[$name] ??= preg_match(self::FLUSHES_DRAW_LIST, $name) === 1) {
+            $this->drawList?->flush();
+        }
+
+        $this->calls[$name] = ($this->calls[$name] ?? 0) + 1;
+
+        if ($this->log !== null) {
+            $this->log[] = $name;
+        }
+    }
+}
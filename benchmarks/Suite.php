@@ -0,0 +1,78 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Benchmarks;
+
+use Closure;
+
+/**
+ * Runs named benchmark cases against a fresh StubRaylib each and reports the
+ * median time and the number of raylib calls per iteration.
+ */
+final class Suite
+{
+    // Untimed iterations before measuring, to fill caches and warm up the JIT
+    private const WARMUP = 3;
+
+    /** @var array<string, array{int, Closure}> Cases as name => [iterations, setup] */
+    private array $cases = [];
+
+    /**
+     * @param Closure(StubRaylib): Closure $setup Prepares the case and returns the closure run per iteration
+     */
+    public function add(string $name, int $iterations, Closure $setup): self
+    {
+        $this->cases[$name] = [$iterations, $setup];
+        return $this;
+    }
+
+    /**
+     * @param callable(string): void|null $progress Called with the name of every case before it runs
+     * @return array<string, array{ms: float, calls: float}>
+     */
+    public function run(?string $filter = null, int $repeats = 5, ?callable $progress = null): array
+    {
+        $results = [];
+
+        foreach ($this->cases as $name => [$iterations, $setup]) {
+            if ($filter !== null && !str_contains($name, $filter)) {
+                continue;
+            }
+
+            if ($progress !== null) {
+                $progress($name);
+            }
+
+            $rl = new StubRaylib();
+            $iteration = $setup($rl);
+
+            for ($i = 0; $i < self::WARMUP; $i++) {
+                $iteration();
+            }
+
+            $samples = [];
+            $calls = $rl->totalCalls();
+
+            for ($repeat = 0; $repeat < $repeats; $repeat++) {
+                gc_collect_cycles();
+                $started = hrtime(true);
+
+                for ($i = 0; $i < $iterations; $i++) {
+                    $iteration();
+                }
+
+                $samples[] = (hrtime(true) - $started) / 1e6 / $iterations;
+            }
+
+            sort($samples);
+
+            $results[$name] = [
+                'ms' => $samples[intdiv(count($samples), 2)],
+                'calls' => ($rl->totalCalls() - $calls) / ($iterations * $repeats),
+            ];
+        }
+
+        return $results;
+    }
+}
@@ -0,0 +1,160 @@
+<?php
+
+declare(strict_types=1);
+
+use Aashan\Phpanim\Benchmarks\StubRaylib;
+use Aashan\Phpanim\Benchmarks\Suite;
+use Aashan\Phpanim\Clock\FixedClock;
+use Aashan\Phpanim\Plugins\Plugin;
+use Aashan\Phpanim\Plugins\PluginManager;
+use Aashan\Phpanim\Scheduler;
+use Aashan\Phpanim\Types\Vec2;
+use Aashan\Phpanim\Visualizations\Curve;
+use Aashan\Phpanim\Visualizations\XYGrid;
+
+/**
+ * Benchmark cases, one iteration is one frame unless noted otherwise.
+ */
+return static function (Suite $suite): void {
+    // Many independent schedulers, each looping a single tween
+    foreach ([1_000, 10_000] as $count) {
+        $suite->add("scheduler.tweens.{$count}", 30, static function (StubRaylib $rl) use ($count) {
+            $clock = new FixedClock();
+            $rl->useClock($clock);
+
+            $schedulers = [];
+            for ($i = 0; $i < $count; $i++) {
+                $scheduler = new Scheduler($rl, new Vec2())->tween('x', 0, 100, 1.0)->repeat();
+                $scheduler->start();
+                $schedulers[] = $scheduler;
+            }
+
+            return static function () use ($clock, $schedulers) {
+                $clock->tick();
+
+                foreach ($schedulers as $scheduler) {
+                    $scheduler->update();
+                }
+            };
+        });
+    }
+
+    // Staggered entrances, most schedulers waiting for their turn at any time
+    $suite->add('scheduler.staggered.10000', 60, static function (StubRaylib $rl) {
+        $clock = new FixedClock();
+        $rl->useClock($clock);
+
+        for ($i = 0; $i < 10_000; $i++) {
+            new Scheduler($rl, new Vec2())
+                ->wait(($i % 1_000) * 0.01)
+                ->tween('y', -10, 0, 0.5)
+                ->wait(10)
+                ->repeat()
+                ->play();
+        }
+
+        return static function () use ($clock, $rl) {
+            $clock->tick();
+            $rl->runtime()->update();
+        };
+    });
+
+    // One looping scheduler running sequences of tweens in parallel
+    $suite->add('scheduler.nested.100', 60, static function (StubRaylib $rl) {
+        $clock = new FixedClock();
+        $rl->useClock($clock);
+
+        $branches = [];
+        for ($i = 0; $i < 100; $i++) {
+            $point = new Vec2();
+            $branches[] = new Scheduler($rl, $point)
+                ->tween('x', 0, 1, 0.25)
+                ->then(new Scheduler($rl, $point)->tween('y', 0, 1, 0.25)->wait(0.1))
+                ->tweenMulti(0.25, ['x' => [1, 0], 'y' => [1, 0]]);
+        }
+
+        $root = new Scheduler($rl, new stdClass())->parallel($branches)->repeat();
+        $root->start();
+
+        return static function () use ($clock, $root) {
+            $clock->tick();
+            $root->update();
+        };
+    });
+
+    // A curve revealed from left to right over two seconds, then again
+    foreach ([100, 1_000, 10_000, 100_000] as $segments) {
+        $suite->add("curve.sweep.{$segments}", 120, static function (StubRaylib $rl) use ($segments) {
+            $curve = new Curve(
+                origin: new Vec2(800, 450),
+                min: new Vec2(-35, -2),
+                max: new Vec2(-35, 2),
+                fn: static fn(float $x): float => sin($x),
+                segments: $segments,
+            );
+
+            $frame = 0;
+
+            return static function () use ($rl, $curve, &$frame) {
+                $curve->max->x = -35 + 70 * (($frame++ % 120) + 1) / 120;
+                $curve->render($rl);
+                $rl->drawList()->flush();
+            };
+        });
+    }
+
+    foreach ([[800, 600], [1600, 900], [3840, 2160]] as [$width, $height]) {
+        $grid = static fn() => new XYGrid(origin: new Vec2($width / 2, $height / 2));
+
+        // Unchanged grid, drawn from its cached texture
+        $suite->add("xygrid.cached.{$width}x{$height}", 240, static function (StubRaylib $rl) use ($grid, $width, $height) {
+            $rl->width = $width;
+            $rl->height = $height;
+            $xyGrid = $grid();
+
+            return static function () use ($rl, $xyGrid) {
+                $xyGrid->render($rl);
+                $rl->drawList()->flush();
+            };
+        });
+
+        // Panning grid, redrawn every frame
+        $suite->add("xygrid.redraw.{$width}x{$height}", 30, static function (StubRaylib $rl) use ($grid, $width, $height) {
+            $rl->width = $width;
+            $rl->height = $height;
+            $xyGrid = $grid();
+
+            return static function () use ($rl, $xyGrid) {
+                $xyGrid->origin->x += 1;
+                $xyGrid->render($rl);
+                $rl->drawList()->flush();
+            };
+        });
+    }
+
+    // PluginManager::update() over plugins that do nothing
+    $suite->add('plugins.dispatch.100', 1_000, static function (StubRaylib $rl) {
+        // PluginManager loads plugins from a directory, give it an empty one
+        $directory = sys_get_temp_dir() . '/phpanim-bench-' . getmypid();
+        mkdir($directory);
+        $manager = new PluginManager($directory);
+        rmdir($directory);
+
+        for ($i = 0; $i < 100; $i++) {
+            $manager->register(new class ($i) extends Plugin {
+                public function __construct(private int $index) {}
+
+                public function getName(): string
+                {
+                    return "noop {$this->index}";
+                }
+            });
+        }
+
+        $manager->initialize($rl);
+
+        return static function () use ($rl, $manager) {
+            $manager->update($rl);
+        };
+    });
+};
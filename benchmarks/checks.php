@@ -0,0 +1,213 @@
+<?php
+
+/**
+ * Behaviour checks that run headless, against StubRaylib and without the
+ * draw shim, like the benchmarks. Covers the PHP fallbacks the shim
+ * replaces, which nothing else exercises on a machine that has it built.
+ *
+ * Usage: php benchmarks/checks.php [filter]
+ *
+ * Exits with status 1 when a check fails.
+ */
+
+declare(strict_types=1);
+
+use Aashan\Phpanim\Benchmarks\StubRaylib;
+use Aashan\Phpanim\Clock\RealtimeClock;
+use Aashan\Phpanim\Drawing\DrawList;
+use Aashan\Phpanim\Types\Vec2;
+use Aashan\Phpanim\Types\Vec2Buffer;
+use Aashan\Phpanim\Visualizations\Camera;
+use Aashan\Phpanim\Visualizations\Curve;
+use Aashan\Phpanim\Visualizations\PointCloud;
+use Aashan\Phpanim\Visualizations\XYGrid;
+
+require __DIR__ . '/../vendor/autoload.php';
+
+$filter = $argv[1] ?? null;
+
+$expect = static function (mixed $expected, mixed $actual, string $what): void {
+    if ($expected !== $actual) {
+        throw new RuntimeException(sprintf('%s: expected %s, got %s', $what, var_export($expected, true), var_export($actual, true)));
+    }
+};
+
+$near = static function (float $expected, float $actual, string $what): void {
+    if (abs($expected - $actual) > 1e-5) {
+        throw new RuntimeException(sprintf('%s: expected %.6f, got %.6f', $what, $expected, $actual));
+    }
+};
+
+/** @var array<string, Closure(StubRaylib): void> $checks */
+$checks = [];
+
+$checks['draw_list.without_shim'] = static function (StubRaylib $rl) use ($expect): void {
+    $list = new DrawList($rl, __DIR__ . '/missing-shim.so');
+
+    $expect(false, $list->isNative(), 'isNative()');
+    $expect(null, $list->shim(), 'shim()');
+
+    $points = new Vec2Buffer($rl, 4);
+    $cloud = new PointCloud($rl, 3);
+
+    $list->line(0, 0, 10, 10, 0xFF0000FF);
+    $list->rectangle(1, 2, 3, 4, 0x00FF00FF);
+    $list->text('label', 5, 5, 20, 0x000000FF);
+    $list->splineLinear($points->data, $points->count, 2.0, 0x0000FFFF);
+    $list->points($cloud->x, $cloud->y, $cloud->colors, $cloud->count, 2.0, 0.0, 0.0, 20.0);
+
+    $expect(5, count($list), 'recorded commands');
+
+    $list->flush();
+
+    $expect(0, count($list), 'commands after flush');
+    $expect(
+        ['DrawLine' => 1, 'DrawRectangle' => 4, 'DrawText' => 1, 'DrawSplineLinear' => 1],
+        array_intersect_key($rl->calls, array_flip(['DrawLine', 'DrawRectangle', 'DrawText', 'DrawSplineLinear'])),
+        'replayed calls',
+    );
+};
+
+$checks['draw_list.keeps_order_with_direct_draws'] = static function (StubRaylib $rl) use ($expect): void {
+    $list = $rl->drawList();
+    $rl->log = [];
+
+    $rl->BeginDrawing();
+    $rl->ClearBackground($rl->color(0xFFFFFFFF));
+    $list->line(0, 0, 10, 10, 0xFF0000FF);
+    $list->rectangle(1, 2, 3, 4, 0x00FF00FF);
+    $rl->DrawCircle(5, 5, 2.0, $rl->color(0x0000FFFF));
+    $list->text('on top', 5, 5, 20, 0x000000FF);
+    $rl->DrawLine(0, 10, 10, 0, $rl->color(0x000000FF));
+    $list->circle(8, 8, 1.0, 0x00FF00FF);
+    $rl->EndDrawing();
+
+    $expect(
+        ['BeginDrawing', 'ClearBackground', 'DrawLine', 'DrawRectangle', 'DrawCircle', 'DrawText', 'DrawLine', 'DrawCircle', 'EndDrawing'],
+        array_values(array_filter($rl->log, static fn (string $name) => $name !== 'GetColor')),
+        'call order',
+    );
+    $expect(0, count($list), 'commands left after EndDrawing()');
+};
+
+$checks['curve.pending_commands_survive_a_second_render'] = static function (StubRaylib $rl) use ($expect): void {
+    $curve = new Curve(new Vec2(800, 450), new Vec2(-10, -2), new Vec2(10, 2), static fn(float $x): float => sin($x));
+    $list = $rl->drawList();
+
+    $curve->render($rl);
+    $expect(1, count($list), 'commands after the first render');
+
+    // Rewrites the vertex buffer the first command points into, which has to be drawn first
+    $curve->origin->x = 700;
+    $curve->render($rl);
+
+    $expect(1, $rl->calls['DrawSplineCatmullRom'] ?? 0, 'splines drawn before the second render rewrote them');
+    $expect(1, count($list), 'commands after the second render');
+
+    $list->flush();
+    $expect(2, $rl->calls['DrawSplineCatmullRom'], 'splines drawn');
+};
+
+$checks['curve.resamples_changing_functions'] = static function (StubRaylib $rl) use ($expect): void {
+    $evaluations = 0;
+    $fn = static function (float $x) use (&$evaluations): float {
+        $evaluations++;
+        return sin($x);
+    };
+
+    $cached = new Curve(new Vec2(800, 450), new Vec2(-10, -2), new Vec2(10, 2), $fn);
+    $cached->render($rl);
+    $first = $evaluations;
+    $cached->render($rl);
+    $expect($first, $evaluations, 'evaluations of an unchanged cached curve');
+
+    $cached->invalidate();
+    $cached->render($rl);
+    $expect(2 * $first, $evaluations, 'evaluations after invalidate()');
+
+    $uncached = new Curve(new Vec2(800, 450), new Vec2(-10, -2), new Vec2(10, 2), $fn, cache: false);
+    $uncached->render($rl);
+    $uncached->render($rl);
+    $expect(4 * $first, $evaluations, 'evaluations of an uncached curve');
+};
+
+$checks['camera.zero_and_negative_zoom'] = static function (StubRaylib $rl) use ($expect): void {
+    foreach ([0.0, -1.0] as $zoom) {
+        $camera = Camera::centered($rl, $zoom);
+        $grid = new XYGrid(origin: new Vec2(), camera: $camera);
+        $curve = new Curve(new Vec2(), new Vec2(-10, -2), new Vec2(10, 2), static fn(float $x): float => sin($x), camera: $camera);
+
+        $grid->render($rl);
+        $curve->render($rl);
+
+        $expect(false, $camera->isVisible(), "isVisible() at zoom {$zoom}");
+        $expect(true, is_finite($camera->toGraph(0, 0)->x), "toGraph() at zoom {$zoom}");
+    }
+
+    $expect(0, count($rl->drawList()), 'commands recorded');
+    $expect(0, $rl->calls['DrawTextureRec'] ?? 0, 'grids drawn');
+};
+
+$checks['vec2_buffer.rotate_without_shim'] = static function (StubRaylib $rl) use ($near): void {
+    $buffer = new Vec2Buffer($rl, 2);
+    $buffer->set(0, 1.0, 0.0);
+    $buffer->set(1, 2.0, 1.0);
+
+    $buffer->rotate(90.0, 1.0, 1.0);
+
+    $near(2.0, $buffer->get(0)->x, 'x of point 0');
+    $near(1.0, $buffer->get(0)->y, 'y of point 0');
+    $near(1.0, $buffer->get(1)->x, 'x of point 1');
+    $near(2.0, $buffer->get(1)->y, 'y of point 1');
+};
+
+$checks['point_cloud.step_without_shim'] = static function (StubRaylib $rl) use ($near): void {
+    $cloud = new PointCloud($rl, 2);
+    $cloud->set(1, 1.0, 2.0);
+    $cloud->setVelocity(1, 4.0, -2.0);
+
+    $cloud->step(0.5);
+
+    $near(0.0, $cloud->x[0], 'x of point 0');
+    $near(3.0, $cloud->x[1], 'x of point 1');
+    $near(1.0, $cloud->y[1], 'y of point 1');
+};
+
+$checks['realtime_clock.resume_after_idling'] = static function (StubRaylib $rl) use ($near): void {
+    $clock = new RealtimeClock($rl);
+    $clock->tick();
+
+    // Five seconds idle, then woken up by input
+    $rl->time = 5.0;
+    $clock->resume();
+    $clock->tick();
+
+    $near(1.0 / 60.0, $clock->getFrameTime(), 'frame time after idling');
+    $near(5.0 + 1.0 / 60.0, $clock->getTime(), 'time after idling');
+
+    $rl->time = 5.02;
+    $clock->tick();
+
+    $near(0.02, $clock->getFrameTime(), 'frame time of the next frame');
+};
+
+$failed = 0;
+
+foreach ($checks as $name => $check) {
+    if ($filter !== null && !str_contains($name, $filter)) {
+        continue;
+    }
+
+    try {
+        $check(new StubRaylib());
+        printf("%-50s ok\n", $name);
+    } catch (Throwable $e) {
+        $failed++;
+        printf("%-50s FAILED\n    %s\n", $name, $e->getMessage());
+    }
+}
+
+if ($failed > 0) {
+    printf("\n%d check(s) failed\n", $failed);
+    exit(1);
+}
@@ -0,0 +1,82 @@
+<?php
+
+/**
+ * Compares direct FFI draw calls against DrawList, with and without the
+ * native shim.
+ *
+ * Usage: php benchmarks/draw_list.php [commands per frame] [frames]
+ */
+
+declare(strict_types=1);
+
+use Aashan\Phpanim\Drawing\DrawList;
+use Aashan\Phpanim\Raylib;
+
+require __DIR__ . '/../vendor/autoload.php';
+
+$commands = (int) ($argv[1] ?? 5000);
+$frames = (int) ($argv[2] ?? 120);
+
+$extension = match (PHP_OS_FAMILY) {
+    'Windows' => 'dll',
+    'Darwin' => 'dylib',
+    default => 'so',
+};
+
+$lib = __DIR__ . '/../lib';
+$rl = new Raylib("{$lib}/libraylib.{$extension}", file_get_contents("{$lib}/raylib.h"));
+
+$rl->SetConfigFlags(Raylib::FLAG_WINDOW_HIDDEN);
+$rl->InitWindow(1600, 900, 'Phpanim DrawList benchmark');
+$rl->SetTargetFPS(0);
+
+$run = static function (callable $draw) use ($rl, $frames): float {
+    $started = hrtime(true);
+
+    for ($frame = 0; $frame < $frames; $frame++) {
+        $rl->BeginDrawing();
+        $rl->ClearBackground($rl->color(0xFFFFFFFF));
+        $draw();
+        $rl->EndDrawing();
+    }
+
+    return (hrtime(true) - $started) / 1e6 / $frames;
+};
+
+$results = [];
+
+$results['direct'] = $run(static function () use ($rl, $commands) {
+    $color = $rl->color(0x808080FF);
+
+    for ($i = 0; $i < $commands; $i++) {
+        $rl->DrawLine($i % 1600, 0, $i % 1600, 900, $color);
+    }
+});
+
+$lists = ['draw list (php)' => new DrawList($rl)];
+
+$shim = "{$lib}/libphpanim_draw.{$extension}";
+if (file_exists($shim)) {
+    $lists['draw list (native)'] = new DrawList($rl, $shim);
+} else {
+    fwrite(STDERR, "Native shim not built, run `composer build-draw-shim` to include it.\n");
+}
+
+foreach ($lists as $name => $list) {
+    $results[$name] = $run(static function () use ($list, $commands) {
+        for ($i = 0; $i < $commands; $i++) {
+            $list->line($i % 1600, 0, $i % 1600, 900, 0x808080FF);
+        }
+
+        $list->flush();
+    });
+}
+
+$rl->CloseWindow();
+
+printf("%d commands per frame, %d frames\n\n", $commands, $frames);
+printf("%-20s %12s %10s\n", 'mode', 'ms/frame', 'speedup');
+
+foreach ($results as $name => $milliseconds) {
+    printf("%-20s %12.3f %9.2fx\n", $name, $milliseconds, $results['direct'] / $milliseconds);
+}
@@ -0,0 +1,119 @@
+#!/usr/bin/env php
+<?php
+
+/**
+ * Runs the headless benchmark suite and compares it against the baseline.
+ *
+ * Usage: php benchmarks/run.php [--filter=<substring>] [--repeats=5]
+ *            [--threshold=0.25] [--baseline=benchmarks/baseline.json] [--update-baseline]
+ *            [--check]
+ *
+ * Exits with status 1 when a case got slower than its baseline by more than
+ * the threshold, or makes more raylib calls than it did.
+ *
+ * --check is meant for CI: timings are ignored, as they only compare on the
+ * same machine, and the run also fails when there is no baseline or a case
+ * is missing from it. The committed baseline records call counts only, with
+ * its timings left null until they are recorded locally.
+ */
+
+declare(strict_types=1);
+
+use Aashan\Phpanim\Benchmarks\Suite;
+
+require __DIR__ . '/../vendor/autoload.php';
+
+// Call counts average over the measured frames, so they only compare at the same number of repeats
+const CHECK_REPEATS = 5;
+
+$options = getopt('', ['filter:', 'repeats:', 'threshold:', 'baseline:', 'update-baseline', 'check']);
+
+$check = isset($options['check']);
+$filter = $options['filter'] ?? null;
+$repeats = $check ? CHECK_REPEATS : max(1, (int) ($options['repeats'] ?? CHECK_REPEATS));
+$threshold = (float) ($options['threshold'] ?? 0.25);
+$baselinePath = $options['baseline'] ?? __DIR__ . '/baseline.json';
+
+$suite = new Suite();
+(require __DIR__ . '/cases.php')($suite);
+
+$results = $suite->run($filter, $repeats, static function (string $name) {
+    fwrite(STDERR, "Running {$name}...\n");
+});
+
+$baseline = file_exists($baselinePath)
+    ? json_decode((string) file_get_contents($baselinePath), true, flags: JSON_THROW_ON_ERROR)
+    : [];
+
+if ($check && $baseline === []) {
+    printf("No baseline at %s, --check needs one.\n", $baselinePath);
+    exit(1);
+}
+
+$regressions = 0;
+
+printf("\n%-28s %10s %10s %8s %10s %10s  %s\n", 'case', 'ms', 'base ms', 'change', 'calls', 'base', 'status');
+
+foreach ($results as $name => ['ms' => $ms, 'calls' => $calls]) {
+    $base = $baseline[$name] ?? null;
+    $status = 'new';
+    $change = '';
+
+    // Baselines without a timing only compare calls
+    $timed = !$check && ($base['ms'] ?? null) !== null;
+
+    if ($base !== null) {
+        $change = $timed ? sprintf('%+.1f%%', ($ms / max($base['ms'], 1e-9) - 1) * 100) : '';
+        $status = 'ok';
+
+        if ($timed && $ms > $base['ms'] * (1 + $threshold)) {
+            $status = 'SLOWER';
+        } elseif ($calls > $base['calls'] + 1e-6) {
+            $status = 'MORE CALLS';
+        }
+    } elseif ($check) {
+        $status = 'NO BASELINE';
+    }
+
+    if ($status !== 'ok' && $status !== 'new') {
+        $regressions++;
+    }
+
+    printf(
+        "%-28s %10.3f %10s %8s %10.1f %10s  %s\n",
+        $name,
+        $ms,
+        ($base['ms'] ?? null) === null ? '-' : sprintf('%.3f', $base['ms']),
+        $change,
+        $calls,
+        $base === null ? '-' : sprintf('%.1f', $base['calls']),
+        $status,
+    );
+}
+
+if (isset($options['update-baseline'])) {
+    // Cases that were filtered out keep their previous baseline
+    $baseline = array_merge($baseline, $results);
+    ksort($baseline);
+
+    file_put_contents($baselinePath, json_encode($baseline, JSON_PRETTY_PRINT) . "\n");
+    printf("\nBaseline written to %s\n", $baselinePath);
+
+    exit(0);
+}
+
+if ($baseline === []) {
+    printf("\nNo baseline at %s, record one with --update-baseline.\n", $baselinePath);
+    exit(0);
+}
+
+if ($regressions > 0) {
+    printf(
+        $check ? "\n%d case(s) make more calls than their baseline or have none.\n" : "\n%d case(s) regressed past the %.0f%% threshold.\n",
+        $regressions,
+        $threshold * 100,
+    );
+    exit(1);
+}
+
+printf("\nNo regressions.\n");
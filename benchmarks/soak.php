@@ -0,0 +1,102 @@
+<?php
+
+/**
+ * Soak test for long-running loops: repeats a scheduler using then(),
+ * parallel() and wait() for a million cycles and checks that memory stays
+ * flat once it is warmed up.
+ *
+ * Usage: php benchmarks/soak.php [cycles] [tolerance in KiB]
+ *
+ * Exits with status 1 when the memory in use or the peak grew by more than
+ * the tolerance after the warm-up.
+ */
+
+declare(strict_types=1);
+
+use Aashan\Phpanim\Benchmarks\StubRaylib;
+use Aashan\Phpanim\Clock\FixedClock;
+use Aashan\Phpanim\Scheduler;
+use Aashan\Phpanim\Types\Vec2;
+
+require __DIR__ . '/../vendor/autoload.php';
+
+$cycles = (int) ($argv[1] ?? 1_000_000);
+$tolerance = (int) ($argv[2] ?? 64) * 1024;
+
+// Cycles run before measuring, so every Fiber, copy and runtime exists already
+$warmup = min(1_000, intdiv($cycles, 10));
+
+$rl = new StubRaylib();
+$clock = new FixedClock();
+$rl->useClock($clock);
+
+// Every step takes one frame, so a cycle is a few frames
+$frame = 1.0 / 60.0;
+$point = new Vec2();
+$completed = 0;
+
+$scheduler = new Scheduler($rl, $point)
+    ->tween('x', 0, 1, $frame)
+    ->wait($frame)
+    ->then(new Scheduler($rl, $point)->tween('y', 0, 1, $frame))
+    ->parallel([
+        new Scheduler($rl, $point)->tween('x', 1, 0, $frame),
+        new Scheduler($rl, $point)->wait($frame)->then(new Scheduler($rl, $point)->tween('y', 1, 0, $frame)),
+    ])
+    ->manual(static function () use (&$completed) {
+        $completed++;
+    })
+    ->repeat()
+    ->play();
+
+$runtime = $rl->runtime();
+
+$run = static function (int $until) use ($clock, $runtime, &$completed): void {
+    while ($completed < $until) {
+        $clock->tick();
+        $runtime->update();
+    }
+};
+
+$run($warmup);
+
+gc_collect_cycles();
+memory_reset_peak_usage();
+
+$baseline = memory_get_usage();
+$started = hrtime(true);
+
+printf("%12s %12s %12s %10s\n", 'cycles', 'memory KiB', 'peak KiB', 'seconds');
+
+$checkpoints = 10;
+for ($i = 1; $i <= $checkpoints; $i++) {
+    $run($warmup + intdiv(($cycles - $warmup) * $i, $checkpoints));
+
+    printf(
+        "%12d %12.1f %12.1f %10.1f\n",
+        $completed,
+        memory_get_usage() / 1024,
+        memory_get_peak_usage() / 1024,
+        (hrtime(true) - $started) / 1e9,
+    );
+}
+
+gc_collect_cycles();
+
+$grown = memory_get_usage() - $baseline;
+$peakGrown = memory_get_peak_usage() - $baseline;
+
+printf(
+    "\nAfter %d cycles (%d frames): memory %+.1f KiB, peak %+.1f KiB over the warmed up baseline\n",
+    $completed,
+    $clock->getFrame(),
+    $grown / 1024,
+    $peakGrown / 1024,
+);
+
+if ($grown > $tolerance || $peakGrown > $tolerance) {
+    printf("FAILED: memory grew by more than %d KiB\n", $tolerance / 1024);
+    exit(1);
+}
+
+echo "OK\n";
@@ -0,0 +1,49 @@
+#!/usr/bin/env php
+<?php
+
+/**
+ * Compiles lib/phpanim_draw.c into a shared library next to the bundled
+ * raylib, which DrawList uses to execute its command buffer natively.
+ *
+ * Run it with `composer build-draw-shim`. The compiler can be overridden
+ * with the CC environment variable.
+ */
+
+declare(strict_types=1);
+
+$lib = realpath(__DIR__ . '/../lib');
+$compiler = getenv('CC') ?: 'cc';
+
+[$output, $raylib, $flags] = match (PHP_OS_FAMILY) {
+    'Darwin' => ['libphpanim_draw.dylib', 'libraylib.dylib', ['-dynamiclib', '-Wl,-rpath,@loader_path']],
+    'Linux' => ['libphpanim_draw.so', 'libraylib.so', ['-shared', '-fPIC', '-Wl,-rpath,$ORIGIN']],
+    'Windows' => ['libphpanim_draw.dll', 'libraylib.dll', ['-shared']],
+    default => throw new RuntimeException('Unsupported platform ' . PHP_OS_FAMILY . '.'),
+};
+
+if (!file_exists("{$lib}/{$raylib}")) {
+    fwrite(STDERR, "Raylib library not found at {$lib}/{$raylib}.\n");
+    exit(1);
+}
+
+$command = [
+    $compiler,
+    '-std=c99',
+    '-O2',
+    '-Wall',
+    ...$flags,
+    "-I{$lib}",
+    "{$lib}/phpanim_draw.c",
+    "{$lib}/{$raylib}",
+    '-o', "{$lib}/{$output}",
+];
+
+$process = proc_open($command, [], $pipes);
+$status = is_resource($process) ? proc_close($process) : -1;
+
+if ($status !== 0) {
+    fwrite(STDERR, "Failed to build the draw shim, {$compiler} exited with status {$status}.\n");
+    exit(1);
+}
+
+fprintf(STDOUT, "Built %s/%s\n", $lib, $output);
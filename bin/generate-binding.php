@@ -0,0 +1,202 @@
+#!/usr/bin/env php
+<?php
+
+/**
+ * Generates the RaylibFunctions trait in src/Generated from lib/raylib.h.
+ *
+ * Every function declared in the header becomes a real, typed method that
+ * calls FFI directly, so calls do not go through Raylib::__call(). Methods
+ * that draw, or change where later draws land, flush the draw list first so
+ * batched and direct draws stay in the order they were made. While
+ * profiling, the handle the methods call is a CountingFfi, so the binding
+ * itself never counts. Run it with `composer generate-binding` whenever the
+ * header changes.
+ */
+
+declare(strict_types=1);
+
+$header = $argv[1] ?? __DIR__ . '/../lib/raylib.h';
+$directory = $argv[2] ?? __DIR__ . '/../src/Generated';
+
+const INT_TYPES = ['int', 'unsigned int', 'long', 'unsigned long', 'short', 'unsigned short', 'unsigned char'];
+const FLOAT_TYPES = ['float', 'double'];
+
+// Functions that draw or change the target, shaders or resources pending draw list commands use
+const FLUSHES_DRAW_LIST = '/^(Draw|ClearBackground$|Begin|End|SwapScreenBuffer$|TakeScreenshot$|LoadImageFrom(Texture|Screen)$|Unload(RenderTexture|Texture|Font|Shader)$|UpdateTexture|SetShaderValue|SetTextureFilter$)/';
+
+/**
+ * Normalizes a C type, e.g. 'const char*' and 'const char *' both become 'const char *'.
+ */
+function normalizeType(string $type): string
+{
+    $type = preg_replace('/\s+/', ' ', trim($type));
+    $type = preg_replace('/\s*\*/', ' *', $type);
+
+    return str_replace('* *', '**', $type);
+}
+
+function isPointer(string $type): bool
+{
+    return str_ends_with($type, '*');
+}
+
+function isCharPointer(string $type): bool
+{
+    return preg_match('/^(const )?char \*$/', $type) === 1;
+}
+
+function parameterType(string $type): string
+{
+    return match (true) {
+        isCharPointer($type) => 'CData|string|null',
+        isPointer($type) => '?CData',
+        $type === 'bool' => 'bool',
+        $type === 'char' => 'string', // FFI passes a plain char as a one byte string
+        in_array($type, INT_TYPES, true) => 'int|float', // FFI used to convert floats, callers still pass them
+        in_array($type, FLOAT_TYPES, true) => 'float',
+        default => 'CData',
+    };
+}
+
+function returnType(string $type): string
+{
+    return match (true) {
+        $type === 'const char *' => '?string',
+        isPointer($type) => '?CData',
+        $type === 'void' => 'void',
+        $type === 'bool' => 'bool',
+        $type === 'char' => 'string',
+        in_array($type, INT_TYPES, true) => 'int',
+        in_array($type, FLOAT_TYPES, true) => 'float',
+        default => 'CData',
+    };
+}
+
+/**
+ * @return array{string, string}|null [type, name], null for 'void'
+ */
+function parseParameter(string $parameter): ?array
+{
+    $parameter = trim($parameter);
+
+    if ($parameter === 'void' || $parameter === '') {
+        return null;
+    }
+
+    if ($parameter === '...') {
+        return ['...', 'args'];
+    }
+
+    preg_match('/^(.*?)(\w+)$/', $parameter, $matches);
+
+    return [normalizeType($matches[1]), $matches[2]];
+}
+
+$functions = [];
+
+foreach (file($header, FILE_IGNORE_NEW_LINES) as $line) {
+    $comment = '';
+    if (($position = strpos($line, '//')) !== false) {
+        $comment = trim(substr($line, $position + 2));
+        $line = substr($line, 0, $position);
+    }
+
+    $line = trim($line);
+
+    if (!preg_match('/^([A-Za-z_][\w\s]*[\s*]+)([A-Za-z_]\w*)\((.*)\);$/', $line, $matches)) {
+        continue;
+    }
+
+    [, $returns, $name, $parameters] = $matches;
+
+    if (str_starts_with($returns, 'typedef') || isset($functions[$name])) {
+        continue;
+    }
+
+    $functions[$name] = [
+        'returns' => normalizeType($returns),
+        'parameters' => array_values(array_filter(array_map('parseParameter', explode(',', $parameters)))),
+        'comment' => $comment,
+    ];
+}
+
+/**
+ * Renders a trait with one method per function, the ones matching
+ * FLUSHES_DRAW_LIST flush Raylib::drawList() before the FFI call.
+ */
+function renderTrait(string $trait, string $description, array $functions): string
+{
+    $methods = [];
+
+    foreach ($functions as $name => $function) {
+        $signature = [];
+        $arguments = [];
+
+        foreach ($function['parameters'] as [$type, $parameter]) {
+            if ($type === '...') {
+                $signature[] = 'mixed ...$args';
+                $arguments[] = '...$args';
+                continue;
+            }
+
+            $signature[] = parameterType($type) . ' $' . $parameter;
+            $arguments[] = (in_array($type, INT_TYPES, true) ? '(int) $' : '$') . $parameter;
+        }
+
+        $returns = returnType($function['returns']);
+        $call = sprintf('$this->ffi->%s(%s);', $name, implode(', ', $arguments));
+
+        $method = '';
+        if ($function['comment'] !== '') {
+            $method .= "    /** {$function['comment']} */\n";
+        }
+
+        $method .= sprintf("    public function %s(%s): %s\n", $name, implode(', ', $signature), $returns);
+        $method .= "    {\n";
+        if (preg_match(FLUSHES_DRAW_LIST, $name) === 1) {
+            $method .= "        \$this->drawList?->flush();\n";
+        }
+        $method .= '        ' . ($returns === 'void' ? '' : 'return ') . $call . "\n";
+        $method .= "    }\n";
+
+        $methods[] = $method;
+    }
+
+    $pattern = var_export(FLUSHES_DRAW_LIST, true);
+
+    $code = <<<PHP
+    <?php
+
+    // This file is generated by bin/generate-binding.php from lib/raylib.h, do not edit it by hand.
+
+    declare(strict_types=1);
+
+    namespace Aashan\Phpanim\Generated;
+
+    use FFI\CData;
+
+    /**
+     * {$description}
+     *
+     * @property-read \FFI|\Aashan\Phpanim\Profiling\CountingFfi \$ffi
+     */
+    trait {$trait}
+    {
+        // Names of the methods that flush the draw list before calling FFI
+        public const FLUSHES_DRAW_LIST = {$pattern};
+
+
+    PHP;
+
+    return $code . implode("\n", $methods) . "}\n";
+}
+
+$code = renderTrait(
+    'RaylibFunctions',
+    'Typed methods for every function declared in lib/raylib.h.',
+    $functions,
+);
+
+file_put_contents("{$directory}/RaylibFunctions.php", $code);
+
+fprintf(STDOUT, "Generated %d functions into %s\n", count($functions), realpath($directory));
@@ -5,6 +5,10 @@ use Aashan\Phpanim\Raylib;
 
 return new class extends Plugin {
 
+    // The label only changes when the FPS does, not every frame
+    private int $fps = -1;
+    private string $label = '';
+
     public function getName(): string
     {
         return 'FPS';
@@ -12,12 +16,18 @@ return new class extends Plugin {
 
     public function update(Raylib $raylib): void 
     {
+        $fps = $raylib->GetFPS();
+
+        if ($fps !== $this->fps) {
+            $this->fps = $fps;
+            $this->label = "FPS: {$fps}";
+        }
 
-        $raylib->DrawText(
-            sprintf("FPS: %d", $raylib->GetFPS()),
+        $raylib->drawList()->text(
+            $this->label,
             10, 10,
             20, 
-            $raylib->GetColor(0xFF0000FF)
+            0xFF0000FF
         );
 
     }
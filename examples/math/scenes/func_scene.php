@@ -1,6 +1,7 @@
 <?php
 declare(strict_types=1);
 
+use Aashan\Phpanim\Plugins\IdleAware;
 use Aashan\Phpanim\Raylib;
 use Aashan\Phpanim\Scenes\SceneInterface;
 use Aashan\Phpanim\Scheduler;
@@ -8,7 +9,7 @@ use Aashan\Phpanim\Types\Vec2;
 use Aashan\Phpanim\Visualizations\Curve;
 use Aashan\Phpanim\Visualizations\XYGrid;
 
-class FuncScene implements SceneInterface
+class FuncScene implements SceneInterface, IdleAware
 {
     private Scheduler $scheduler;
     private bool $done = false;
@@ -65,6 +66,7 @@ class FuncScene implements SceneInterface
     
     public function unload(Raylib $rl): void
     {
+        $this->graph->unload($rl);
     }
     
     public function update(Raylib $rl): void
@@ -74,6 +76,11 @@ class FuncScene implements SceneInterface
         $this->curve->render($rl);
     }
     
+    public function nextUpdateIn(Raylib $rl): float
+    {
+        return $this->scheduler->nextUpdateIn();
+    }
+
     public function done(Raylib $rl): bool
     {
         return $this->done;
@@ -0,0 +1,113 @@
+// Native executor for the PHP DrawList command buffer.
+//
+// Every command would otherwise be its own FFI call from PHP, with the
+// argument marshalling that comes with it. Here a whole frame worth of
+// commands is replayed against raylib with a single crossing.
+//
+// Build with `composer build-draw-shim`.
+
+#include <stdbool.h>
+
+#include "raylib.h"
+#include "phpanim_draw.h"
+
+static void DrawPoints(const PhpanimPoints *points, int count, const float *args)
+{
+    float size = args[0];
+    float half = size / 2.0f;
+
+    // Every point is a quad in raylib's render batch, which is only
+    // submitted to the GPU when full, so this stays a handful of draw calls
+    for (int i = 0; i < count; i++) {
+        Rectangle rec = {
+            args[1] + points->x[i] * args[3] - half,
+            args[2] - points->y[i] * args[3] - half,
+            size,
+            size,
+        };
+
+        DrawRectangleRec(rec, GetColor(points->colors[i]));
+    }
+}
+
+int PhpanimDrawBatch(const PhpanimDrawCommand *commands, int count, const char *text)
+{
+    int calls = 0;
+
+    for (int i = 0; i < count; i++) {
+        const PhpanimDrawCommand *command = &commands[i];
+        const float *args = command->args;
+        Color color = GetColor(command->color);
+
+        switch (command->op) {
+            case PHPANIM_DRAW_LINE:
+                DrawLine((int)args[0], (int)args[1], (int)args[2], (int)args[3], color);
+                break;
+            case PHPANIM_DRAW_LINE_EX:
+                DrawLineEx((Vector2){ args[0], args[1] }, (Vector2){ args[2], args[3] }, args[4], color);
+                break;
+            case PHPANIM_DRAW_RECTANGLE:
+                DrawRectangle((int)args[0], (int)args[1], (int)args[2], (int)args[3], color);
+                break;
+            case PHPANIM_DRAW_CIRCLE:
+                DrawCircle((int)args[0], (int)args[1], args[2], color);
+                break;
+            case PHPANIM_DRAW_TRIANGLE:
+                DrawTriangle(
+                    (Vector2){ args[0], args[1] },
+                    (Vector2){ args[2], args[3] },
+                    (Vector2){ args[4], args[5] },
+                    color
+                );
+                break;
+            case PHPANIM_DRAW_TEXT:
+                DrawText(text + command->count, (int)args[0], (int)args[1], (int)args[2], color);
+                break;
+            case PHPANIM_DRAW_SPLINE_LINEAR:
+                DrawSplineLinear((const Vector2 *)command->points, command->count, args[0], color);
+                break;
+            case PHPANIM_DRAW_SPLINE_CATMULL_ROM:
+                DrawSplineCatmullRom((const Vector2 *)command->points, command->count, args[0], color);
+                break;
+            case PHPANIM_DRAW_TEXT_EX:
+                DrawTextEx(*(const Font *)command->points, text + command->count, (Vector2){ args[0], args[1] }, args[2], args[3], color);
+                break;
+            case PHPANIM_DRAW_POINTS:
+                DrawPoints((const PhpanimPoints *)command->points, command->count, args);
+                calls += command->count - 1; // One DrawRectangleRec per point
+                break;
+            default:
+                continue; // Unknown operation, skip it
+        }
+
+        calls++;
+    }
+
+    return calls;
+}
+
+void PhpanimIntegrate(float *x, float *y, const float *vx, const float *vy, int count, float dt)
+{
+    for (int i = 0; i < count; i++) {
+        x[i] += vx[i] * dt;
+        y[i] += vy[i] * dt;
+    }
+}
+
+void PhpanimLerp(float *out, const float *from, const float *to, int count, float t)
+{
+    for (int i = 0; i < count; i++) {
+        out[i] = from[i] + (to[i] - from[i]) * t;
+    }
+}
+
+void PhpanimTransform(float *out, const float *in, int count, float a, float b, float c, float d, float tx, float ty)
+{
+    for (int i = 0; i < 2 * count; i += 2) {
+        float x = in[i];
+        float y = in[i + 1];
+
+        out[i] = a * x + b * y + tx;
+        out[i + 1] = c * x + d * y + ty;
+    }
+}
@@ -0,0 +1,41 @@
+// Batched draw commands executed natively by libphpanim_draw, see src/Drawing/DrawList.php
+//
+// This file is loaded with FFI::cdef() as well as compiled, so it must only
+// contain plain declarations (no preprocessor directives).
+
+// Draw operations, keep in sync with the DrawList constants
+typedef enum PhpanimDrawOp {
+    PHPANIM_DRAW_LINE = 1,               // args: startX, startY, endX, endY
+    PHPANIM_DRAW_LINE_EX = 2,            // args: startX, startY, endX, endY, thick
+    PHPANIM_DRAW_RECTANGLE = 3,          // args: x, y, width, height
+    PHPANIM_DRAW_CIRCLE = 4,             // args: centerX, centerY, radius
+    PHPANIM_DRAW_TRIANGLE = 5,           // args: x1, y1, x2, y2, x3, y3
+    PHPANIM_DRAW_TEXT = 6,               // args: posX, posY, fontSize; count: offset into the text buffer
+    PHPANIM_DRAW_SPLINE_LINEAR = 7,      // args: thick; points, count: Vector2 array
+    PHPANIM_DRAW_SPLINE_CATMULL_ROM = 8, // args: thick; points, count: Vector2 array
+    PHPANIM_DRAW_POINTS = 9,             // args: size, originX, originY, unitSize; points: PhpanimPoints, count: point count
+    PHPANIM_DRAW_TEXT_EX = 10            // args: posX, posY, fontSize, spacing; points: Font; count: offset into the text buffer
+} PhpanimDrawOp;
+
+// One packed draw command
+typedef struct PhpanimDrawCommand {
+    int op;                 // PhpanimDrawOp
+    unsigned int color;     // Color as 0xRRGGBBAA
+    float args[6];          // Operation arguments
+    int count;              // Point count or text offset
+    const void *points;     // Vector2 array for splines, PhpanimPoints for points, Font for text
+} PhpanimDrawCommand;
+
+// Struct-of-arrays point set, see src/Visualizations/PointCloud.php
+typedef struct PhpanimPoints {
+    const float *x;                 // Graph space X
+    const float *y;                 // Graph space Y
+    const unsigned int *colors;     // Colors as 0xRRGGBBAA
+} PhpanimPoints;
+
+int PhpanimDrawBatch(const PhpanimDrawCommand *commands, int count, const char *text); // Execute commands in order, returns the number of raylib draw calls made
+
+// Bulk kernels over float arrays, one call for the whole array instead of one FFI access per element
+void PhpanimIntegrate(float *x, float *y, const float *vx, const float *vy, int count, float dt); // x += vx * dt, y += vy * dt
+void PhpanimLerp(float *out, const float *from, const float *to, int count, float t);            // out = from + (to - from) * t
+void PhpanimTransform(float *out, const float *in, int count, float a, float b, float c, float d, float tx, float ty); // Interleaved x, y pairs: out = (a * x + b * y + tx, c * x + d * y + ty), in may be out
@@ -61,6 +61,9 @@ typedef struct Texture {
     int format;             // Data format (PixelFormat type)
 } Texture;
 
+// Texture2D, same as Texture
+typedef Texture Texture2D;
+
 // RenderTexture, fbo for texture rendering
 typedef struct RenderTexture {
     unsigned int id;        // OpenGL framebuffer object id
@@ -68,6 +71,9 @@ typedef struct RenderTexture {
     Texture depth;          // Depth buffer attachment texture
 } RenderTexture;
 
+// RenderTexture2D, same as RenderTexture
+typedef RenderTexture RenderTexture2D;
+
 // NPatchInfo, n-patch layout info
 typedef struct NPatchInfo {
     Rectangle source;       // Texture source rectangle
@@ -87,6 +93,16 @@ typedef struct GlyphInfo {
     Image image;            // Character image data
 } GlyphInfo;
 
+// Font, font texture and GlyphInfo array data
+typedef struct Font {
+    int baseSize;           // Base size (default chars height)
+    int glyphCount;         // Number of glyph characters
+    int glyphPadding;       // Padding around the glyph characters
+    Texture2D texture;      // Texture atlas containing the glyphs
+    Rectangle *recs;        // Rectangles in texture for the glyphs
+    GlyphInfo *glyphs;      // Glyphs info data
+} Font;
+
 
 // Camera, defines position/orientation in 3d space
 typedef struct Camera3D {
@@ -311,6 +327,7 @@ void BeginMode2D(Camera2D camera);                          // Begin 2D mode wit
 void EndMode2D(void);                                       // Ends 2D mode with custom camera
 void BeginMode3D(Camera3D camera);                          // Begin 3D mode with custom camera (3D)
 void EndMode3D(void);                                       // Ends 3D mode and returns to default 2D orthographic mode
+void BeginTextureMode(RenderTexture2D target);              // Begin drawing to render texture
 void EndTextureMode(void);                                  // Ends drawing to render texture
 void BeginShaderMode(Shader shader);                        // Begin custom shader drawing
 void EndShaderMode(void);                                   // End custom shader drawing (use default shader)
@@ -552,3 +569,26 @@ bool CheckCollisionPointPoly(Vector2 point, const Vector2 *points, int pointCoun
 bool CheckCollisionLines(Vector2 startPos1, Vector2 endPos1, Vector2 startPos2, Vector2 endPos2, Vector2 *collisionPoint); // Check the collision between two lines defined by two points each, returns collision point by reference
 Rectangle GetCollisionRec(Rectangle rec1, Rectangle rec2);                                         // Get collision rectangle for two rectangles collision
 
+// module: textures
+// Image loading functions
+Image LoadImageFromTexture(Texture2D texture);                     // Load image from GPU texture data
+void UnloadImage(Image image);                                     // Unload image from CPU memory (RAM)
+
+// Texture loading functions
+RenderTexture2D LoadRenderTexture(int width, int height);          // Load texture for rendering (framebuffer)
+bool IsRenderTextureValid(RenderTexture2D target);                 // Check if a render texture is valid (loaded in GPU)
+void UnloadRenderTexture(RenderTexture2D target);                  // Unload render texture from GPU memory (VRAM)
+
+// Texture drawing functions
+void DrawTexture(Texture2D texture, int posX, int posY, Color tint);                               // Draw a Texture2D
+void DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position, Color tint);            // Draw a part of a texture defined by a rectangle
+
+// module: text
+Font GetFontDefault(void);                                                                        // Get the default Font
+Font LoadFont(const char *fileName);                                                              // Load font from file into GPU memory (VRAM)
+Font LoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepointCount);        // Load font from file with extended parameters, use NULL for codepoints and 0 for codepointCount to load the default character set
+bool IsFontValid(Font font);                                                                      // Check if a font is valid (font data loaded, WARNING: GPU texture not checked)
+void UnloadFont(Font font);                                                                       // Unload font from GPU memory (VRAM)
+void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint); // Draw text using font and additional parameters
+Vector2 MeasureTextEx(Font font, const char *text, float fontSize, float spacing);                // Measure string size for Font
+void SetTextureFilter(Texture2D texture, int filter);                                             // Set texture scaling filter mode
@@ -0,0 +1,55 @@
+<?php
+
+/**
+ * opcache.preload script.
+ *
+ * Compiles every class of the library into shared memory and parses the
+ * raylib header into the "phpanim.raylib" FFI scope once, when the server
+ * starts, instead of on every request:
+ *
+ *   opcache.enable=1
+ *   opcache.enable_cli=1
+ *   opcache.preload=/path/to/phpanim/preload.php
+ *   opcache.preload_user=www-data
+ *   ffi.enable=preload
+ *
+ * PHPANIM_RAYLIB and PHPANIM_RAYLIB_HEADER override the library and header,
+ * PHPANIM_PRELOAD_CACHE where the scoped copy of the header is written.
+ */
+
+declare(strict_types=1);
+
+use Aashan\Phpanim\Phpanim;
+use Aashan\Phpanim\Raylib;
+
+$autoload = array_find(
+    [__DIR__ . '/vendor/autoload.php', __DIR__ . '/../../autoload.php'],
+    static fn(string $path) => file_exists($path),
+);
+
+if ($autoload === null) {
+    throw new \RuntimeException('Run composer install before preloading phpanim.');
+}
+
+require $autoload;
+
+// Loading through the autoloader links parents and interfaces first
+$source = realpath(__DIR__ . '/src');
+$files = new RecursiveIteratorIterator(new RecursiveDirectoryIterator($source, FilesystemIterator::SKIP_DOTS));
+
+foreach ($files as $file) {
+    if ($file->getExtension() !== 'php') {
+        continue;
+    }
+
+    $class = 'Aashan\\Phpanim\\' . strtr(substr($file->getPathname(), strlen($source) + 1, -4), '/', '\\');
+
+    class_exists($class) || interface_exists($class) || trait_exists($class) || enum_exists($class);
+}
+
+$library = getenv('PHPANIM_RAYLIB') ?: Phpanim::library('raylib');
+$header = getenv('PHPANIM_RAYLIB_HEADER') ?: __DIR__ . '/lib/raylib.h';
+
+if ($library !== null && file_exists($library) && extension_loaded('ffi')) {
+    Raylib::preload($library, $header, getenv('PHPANIM_PRELOAD_CACHE') ?: sys_get_temp_dir() . '/phpanim');
+}
@@ -0,0 +1,59 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Animation;
+
+use Aashan\Phpanim\Types\Vec2Buffer;
+
+/**
+ * Moves every point of a buffer from where it is when the track starts to
+ * the same point of another buffer.
+ */
+final class BufferMorphTrack implements Track
+{
+    private ?Vec2Buffer $start = null;
+
+    public function __construct(
+        private Vec2Buffer $buffer,
+        private Vec2Buffer $target,
+        private float $duration,
+        private EasingFunction $easing,
+    ) {
+        if ($buffer->count !== $target->count) {
+            throw new \InvalidArgumentException(sprintf(
+                'Cannot morph %d points into %d points.',
+                $buffer->count,
+                $target->count,
+            ));
+        }
+    }
+
+    public function duration(): float
+    {
+        return $this->duration;
+    }
+
+    public function begin(): void
+    {
+        if ($this->start === null) {
+            $this->start = $this->buffer->copy();
+        } else {
+            $this->start->copyFrom($this->buffer);
+        }
+    }
+
+    public function apply(float $time): void
+    {
+        $t = $this->duration > 0.0 ? min(1.0, $time / $this->duration) : 1.0;
+
+        $this->buffer->lerp($this->start, $this->target, $this->easing->ease($t));
+    }
+
+    public function rewind(): void
+    {
+        if ($this->start !== null) {
+            $this->buffer->copyFrom($this->start);
+        }
+    }
+}
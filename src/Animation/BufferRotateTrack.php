@@ -0,0 +1,60 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Animation;
+
+use Aashan\Phpanim\Types\Vec2Buffer;
+use FFI\CData;
+
+/**
+ * Rotates every point of a buffer by a number of degrees around an origin,
+ * as one track with one sine and cosine per frame.
+ */
+final class BufferRotateTrack implements Track
+{
+    private ?Vec2Buffer $start = null;
+
+    private float $originX = 0.0;
+
+    private float $originY = 0.0;
+
+    public function __construct(
+        private Vec2Buffer $buffer,
+        private float $degrees,
+        private float $duration,
+        private ?CData $origin,
+        private EasingFunction $easing,
+    ) {}
+
+    public function duration(): float
+    {
+        return $this->duration;
+    }
+
+    public function begin(): void
+    {
+        if ($this->start === null) {
+            $this->start = $this->buffer->copy();
+        } else {
+            $this->start->copyFrom($this->buffer);
+        }
+
+        $this->originX = $this->origin ? $this->origin->x : 0.0;
+        $this->originY = $this->origin ? $this->origin->y : 0.0;
+    }
+
+    public function apply(float $time): void
+    {
+        $t = $this->duration > 0.0 ? min(1.0, $time / $this->duration) : 1.0;
+
+        $this->buffer->rotate($this->degrees * $this->easing->ease($t), $this->originX, $this->originY, $this->start);
+    }
+
+    public function rewind(): void
+    {
+        if ($this->start !== null) {
+            $this->buffer->copyFrom($this->start);
+        }
+    }
+}
@@ -0,0 +1,22 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Animation;
+
+use Closure;
+
+/**
+ * Adapts a user supplied closure to EasingFunction.
+ */
+final class CallbackEasing implements EasingFunction
+{
+    public function __construct(
+        private Closure $fn,
+    ) {}
+
+    public function ease(float $t): float
+    {
+        return ($this->fn)($t);
+    }
+}
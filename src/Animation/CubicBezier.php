@@ -0,0 +1,135 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Animation;
+
+/**
+ * CSS-style cubic-bezier(x1, y1, x2, y2) easing.
+ *
+ * The curve is solved once per sample when it is created, easing is then a
+ * linear interpolation in a lookup table. Use CubicBezier::of() to share the
+ * table between tracks using the same curve.
+ */
+final class CubicBezier implements EasingFunction
+{
+    // Lookup table resolution, the interpolation error stays well below a pixel
+    private const SAMPLES = 256;
+
+    /** @var array<string, self> */
+    private static array $instances = [];
+
+    /** @var float[] y at x = i / SAMPLES */
+    private array $table = [];
+
+    private bool $linear;
+
+    public function __construct(
+        public readonly float $x1,
+        public readonly float $y1,
+        public readonly float $x2,
+        public readonly float $y2,
+    ) {
+        if ($x1 < 0.0 || $x1 > 1.0 || $x2 < 0.0 || $x2 > 1.0) {
+            throw new \InvalidArgumentException('The x coordinates of a cubic bezier easing must be in [0, 1].');
+        }
+
+        $this->linear = $x1 === $y1 && $x2 === $y2;
+
+        if (!$this->linear) {
+            for ($i = 0; $i <= self::SAMPLES; $i++) {
+                $this->table[$i] = self::bezier($this->solve($i / self::SAMPLES), $y1, $y2);
+            }
+        }
+    }
+
+    /**
+     * Returns a shared instance for the given control points.
+     */
+    public static function of(float $x1, float $y1, float $x2, float $y2): self
+    {
+        return self::$instances["{$x1},{$y1},{$x2},{$y2}"] ??= new self($x1, $y1, $x2, $y2);
+    }
+
+    public function ease(float $t): float
+    {
+        if ($this->linear) {
+            return $t;
+        }
+
+        if ($t <= 0.0) {
+            return 0.0;
+        }
+
+        if ($t >= 1.0) {
+            return 1.0;
+        }
+
+        $position = $t * self::SAMPLES;
+        $index = (int) $position;
+        $y = $this->table[$index];
+
+        return $y + ($this->table[$index + 1] - $y) * ($position - $index);
+    }
+
+    /**
+     * Finds the curve parameter whose x coordinate is $x.
+     */
+    private function solve(float $x): float
+    {
+        // Newton-Raphson from the linear guess converges in a few steps for most curves
+        $s = $x;
+        for ($i = 0; $i < 8; $i++) {
+            $error = self::bezier($s, $this->x1, $this->x2) - $x;
+            if (abs($error) < 1e-7) {
+                return $s;
+            }
+
+            $slope = self::slope($s, $this->x1, $this->x2);
+            if (abs($slope) < 1e-6) {
+                break;
+            }
+
+            $s -= $error / $slope;
+            if ($s < 0.0 || $s > 1.0) {
+                break;
+            }
+        }
+
+        // Bisection for flat spots where Newton stalls, x is monotonic in s
+        $low = 0.0;
+        $high = 1.0;
+        $s = $x;
+
+        while ($high - $low > 1e-7) {
+            $value = self::bezier($s, $this->x1, $this->x2);
+
+            if ($value < $x) {
+                $low = $s;
+            } else {
+                $high = $s;
+            }
+
+            $s = ($low + $high) / 2;
+        }
+
+        return $s;
+    }
+
+    /**
+     * One coordinate of the curve, with the end points fixed at 0 and 1.
+     */
+    private static function bezier(float $s, float $p1, float $p2): float
+    {
+        $inverse = 1 - $s;
+
+        return 3 * $inverse * $inverse * $s * $p1 + 3 * $inverse * $s * $s * $p2 + $s * $s * $s;
+    }
+
+    private static function slope(float $s, float $p1, float $p2): float
+    {
+        $inverse = 1 - $s;
+
+        return 3 * $inverse * $inverse * $p1 + 6 * $inverse * $s * ($p2 - $p1) + 3 * $s * $s * (1 - $p2);
+    }
+}
@@ -0,0 +1,49 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Animation;
+
+use Closure;
+
+/**
+ * Calls a user callback with the target, the progress (0.0 to 1.0) and the
+ * time since the previous call. When seeking backwards the delta is negative.
+ */
+final class CustomTrack implements Track
+{
+    private float $last = 0.0;
+
+    /**
+     * @param Closure(object, float, float): void $fn
+     */
+    public function __construct(
+        private Closure $fn,
+        private object $target,
+        private float $duration,
+    ) {}
+
+    public function duration(): float
+    {
+        return $this->duration;
+    }
+
+    public function begin(): void
+    {
+        $this->last = 0.0;
+    }
+
+    public function apply(float $time): void
+    {
+        $dt = $time - $this->last;
+        $this->last = $time;
+        $progress = $this->duration > 0.0 ? min(1.0, $time / $this->duration) : 1.0;
+
+        ($this->fn)($this->target, $progress, $dt);
+    }
+
+    public function rewind(): void
+    {
+        $this->last = 0.0;
+    }
+}
@@ -0,0 +1,135 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Animation;
+
+/**
+ * The standard easing curves (see https://easings.net), evaluated inline
+ * rather than through a callable.
+ */
+enum Easing: string implements EasingFunction
+{
+    case Linear = 'linear';
+
+    case QuadIn = 'quad-in';
+    case QuadOut = 'quad-out';
+    case QuadInOut = 'quad-in-out';
+
+    case CubicIn = 'cubic-in';
+    case CubicOut = 'cubic-out';
+    case CubicInOut = 'cubic-in-out';
+
+    case QuartIn = 'quart-in';
+    case QuartOut = 'quart-out';
+    case QuartInOut = 'quart-in-out';
+
+    case ExpoIn = 'expo-in';
+    case ExpoOut = 'expo-out';
+    case ExpoInOut = 'expo-in-out';
+
+    case SineIn = 'sine-in';
+    case SineOut = 'sine-out';
+    case SineInOut = 'sine-in-out';
+
+    case BackIn = 'back-in';
+    case BackOut = 'back-out';
+    case BackInOut = 'back-in-out';
+
+    case ElasticIn = 'elastic-in';
+    case ElasticOut = 'elastic-out';
+    case ElasticInOut = 'elastic-in-out';
+
+    case BounceIn = 'bounce-in';
+    case BounceOut = 'bounce-out';
+    case BounceInOut = 'bounce-in-out';
+
+    // Overshoot of the back curves
+    private const BACK = 1.70158;
+    private const BACK_IN_OUT = self::BACK * 1.525;
+
+    // Periods of the elastic curves
+    private const ELASTIC = 2 * M_PI / 3;
+    private const ELASTIC_IN_OUT = 2 * M_PI / 4.5;
+
+    public function ease(float $t): float
+    {
+        return match ($this) {
+            self::Linear => $t,
+
+            self::QuadIn => $t * $t,
+            self::QuadOut => 1 - (1 - $t) * (1 - $t),
+            self::QuadInOut => $t < 0.5 ? 2 * $t * $t : 1 - ((-2 * $t + 2) ** 2) / 2,
+
+            self::CubicIn => $t * $t * $t,
+            self::CubicOut => 1 - (1 - $t) ** 3,
+            self::CubicInOut => $t < 0.5 ? 4 * $t * $t * $t : 1 - ((-2 * $t + 2) ** 3) / 2,
+
+            self::QuartIn => $t ** 4,
+            self::QuartOut => 1 - (1 - $t) ** 4,
+            self::QuartInOut => $t < 0.5 ? 8 * $t ** 4 : 1 - ((-2 * $t + 2) ** 4) / 2,
+
+            self::ExpoIn => $t <= 0.0 ? 0.0 : 2 ** (10 * $t - 10),
+            self::ExpoOut => $t >= 1.0 ? 1.0 : 1 - 2 ** (-10 * $t),
+            self::ExpoInOut => match (true) {
+                $t <= 0.0 => 0.0,
+                $t >= 1.0 => 1.0,
+                $t < 0.5 => (2 ** (20 * $t - 10)) / 2,
+                default => (2 - 2 ** (-20 * $t + 10)) / 2,
+            },
+
+            self::SineIn => 1 - cos($t * M_PI / 2),
+            self::SineOut => sin($t * M_PI / 2),
+            self::SineInOut => -(cos(M_PI * $t) - 1) / 2,
+
+            self::BackIn => (self::BACK + 1) * $t * $t * $t - self::BACK * $t * $t,
+            self::BackOut => 1 + (self::BACK + 1) * ($t - 1) ** 3 + self::BACK * ($t - 1) ** 2,
+            self::BackInOut => $t < 0.5
+                ? ((2 * $t) ** 2 * ((self::BACK_IN_OUT + 1) * 2 * $t - self::BACK_IN_OUT)) / 2
+                : ((2 * $t - 2) ** 2 * ((self::BACK_IN_OUT + 1) * ($t * 2 - 2) + self::BACK_IN_OUT) + 2) / 2,
+
+            self::ElasticIn => match (true) {
+                $t <= 0.0 => 0.0,
+                $t >= 1.0 => 1.0,
+                default => -(2 ** (10 * $t - 10)) * sin(($t * 10 - 10.75) * self::ELASTIC),
+            },
+            self::ElasticOut => match (true) {
+                $t <= 0.0 => 0.0,
+                $t >= 1.0 => 1.0,
+                default => 2 ** (-10 * $t) * sin(($t * 10 - 0.75) * self::ELASTIC) + 1,
+            },
+            self::ElasticInOut => match (true) {
+                $t <= 0.0 => 0.0,
+                $t >= 1.0 => 1.0,
+                $t < 0.5 => -(2 ** (20 * $t - 10) * sin((20 * $t - 11.125) * self::ELASTIC_IN_OUT)) / 2,
+                default => (2 ** (-20 * $t + 10) * sin((20 * $t - 11.125) * self::ELASTIC_IN_OUT)) / 2 + 1,
+            },
+
+            self::BounceIn => 1 - self::bounce(1 - $t),
+            self::BounceOut => self::bounce($t),
+            self::BounceInOut => $t < 0.5
+                ? (1 - self::bounce(1 - 2 * $t)) / 2
+                : (1 + self::bounce(2 * $t - 1)) / 2,
+        };
+    }
+
+    private static function bounce(float $t): float
+    {
+        if ($t < 1 / 2.75) {
+            return 7.5625 * $t * $t;
+        }
+
+        if ($t < 2 / 2.75) {
+            $t -= 1.5 / 2.75;
+            return 7.5625 * $t * $t + 0.75;
+        }
+
+        if ($t < 2.5 / 2.75) {
+            $t -= 2.25 / 2.75;
+            return 7.5625 * $t * $t + 0.9375;
+        }
+
+        $t -= 2.625 / 2.75;
+        return 7.5625 * $t * $t + 0.984375;
+    }
+}
@@ -0,0 +1,17 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Animation;
+
+/**
+ * Maps linear progress to eased progress.
+ */
+interface EasingFunction
+{
+    /**
+     * @param float $t Progress in [0, 1]
+     * @return float Eased progress, 0 at t = 0 and 1 at t = 1, may overshoot in between
+     */
+    public function ease(float $t): float;
+}
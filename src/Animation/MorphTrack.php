@@ -0,0 +1,58 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Animation;
+
+use Aashan\Phpanim\Visualizations\PointCloud;
+use FFI\CData;
+
+/**
+ * Moves every point of a cloud from where it is when the track starts to
+ * the position of the same point in another cloud, with two bulk kernel
+ * calls per frame however many points there are.
+ */
+final class MorphTrack implements Track
+{
+    private ?CData $fromX = null;
+    private ?CData $fromY = null;
+
+    public function __construct(
+        private PointCloud $cloud,
+        private PointCloud $target,
+        private float $duration,
+        private EasingFunction $easing,
+    ) {
+        if ($cloud->count !== $target->count) {
+            throw new \InvalidArgumentException(sprintf(
+                'Cannot morph %d points into %d points.',
+                $cloud->count,
+                $target->count,
+            ));
+        }
+    }
+
+    public function duration(): float
+    {
+        return $this->duration;
+    }
+
+    public function begin(): void
+    {
+        [$this->fromX, $this->fromY] = $this->cloud->snapshot();
+    }
+
+    public function apply(float $time): void
+    {
+        $t = $this->duration > 0.0 ? min(1.0, $time / $this->duration) : 1.0;
+
+        $this->cloud->lerp($this->fromX, $this->fromY, $this->target->x, $this->target->y, $this->easing->ease($t));
+    }
+
+    public function rewind(): void
+    {
+        if ($this->fromX !== null) {
+            $this->cloud->restore($this->fromX, $this->fromY);
+        }
+    }
+}
@@ -0,0 +1,20 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Animation;
+
+use Aashan\Phpanim\Scheduler;
+
+/**
+ * A group of schedulers that run side by side, see Scheduler::parallel().
+ */
+final class Parallel
+{
+    /**
+     * @param Scheduler[] $schedulers
+     */
+    public function __construct(
+        public readonly array $schedulers,
+    ) {}
+}
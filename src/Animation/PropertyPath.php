@@ -0,0 +1,50 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Animation;
+
+/**
+ * A dotted property path such as 'curve.max.x', resolved once against a target.
+ *
+ * The object that owns the final property is looked up when the path is
+ * compiled, so writing a value every frame is a single property assignment.
+ */
+final class PropertyPath
+{
+    private function __construct(
+        public readonly object $owner,
+        public readonly string $property,
+    ) {}
+
+    public static function compile(object $target, string $path): self
+    {
+        $parts = explode('.', $path);
+        $property = array_pop($parts);
+        $owner = $target;
+
+        foreach ($parts as $part) {
+            if (!property_exists($owner, $part) || !is_object($owner->{$part})) {
+                throw new \RuntimeException("Property '{$path}' does not exist on target object.");
+            }
+
+            $owner = $owner->{$part};
+        }
+
+        if (!property_exists($owner, $property)) {
+            throw new \RuntimeException("Property '{$path}' does not exist on target object.");
+        }
+
+        return new self($owner, $property);
+    }
+
+    public function read(): mixed
+    {
+        return $this->owner->{$this->property};
+    }
+
+    public function write(mixed $value): void
+    {
+        $this->owner->{$this->property} = $value;
+    }
+}
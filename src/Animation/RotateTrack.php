@@ -0,0 +1,66 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Animation;
+
+use FFI\CData;
+
+/**
+ * Rotates a point by a number of degrees around an origin.
+ */
+final class RotateTrack implements Track
+{
+    private float $angle;
+
+    private float $startX = 0.0;
+
+    private float $startY = 0.0;
+
+    private float $originX = 0.0;
+
+    private float $originY = 0.0;
+
+    public function __construct(
+        private CData $point,
+        float $degrees,
+        private float $duration,
+        private ?CData $origin,
+        private EasingFunction $easing,
+    ) {
+        $this->angle = deg2rad($degrees);
+    }
+
+    public function duration(): float
+    {
+        return $this->duration;
+    }
+
+    public function begin(): void
+    {
+        $this->startX = $this->point->x;
+        $this->startY = $this->point->y;
+        $this->originX = $this->origin ? $this->origin->x : 0.0;
+        $this->originY = $this->origin ? $this->origin->y : 0.0;
+    }
+
+    public function apply(float $time): void
+    {
+        $t = $this->duration > 0.0 ? min(1.0, $time / $this->duration) : 1.0;
+        $currentAngle = $this->angle * $this->easing->ease($t);
+        $cos = cos($currentAngle);
+        $sin = sin($currentAngle);
+
+        $dx = $this->startX - $this->originX;
+        $dy = $this->startY - $this->originY;
+
+        $this->point->x = ($cos * $dx) - ($sin * $dy) + $this->originX;
+        $this->point->y = ($sin * $dx) + ($cos * $dy) + $this->originY;
+    }
+
+    public function rewind(): void
+    {
+        $this->point->x = $this->startX;
+        $this->point->y = $this->startY;
+    }
+}
@@ -0,0 +1,159 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Animation;
+
+use Aashan\Phpanim\Clock\ClockInterface;
+use Aashan\Phpanim\Scheduler;
+use SplMinHeap;
+
+/**
+ * Updates a set of schedulers, skipping the ones that have nothing to do.
+ *
+ * A scheduler inside wait() is parked in a min-heap keyed by the clock
+ * time it wakes up at and is not touched again until then, so a frame only
+ * costs as much as the schedulers that are actually animating. Finished
+ * schedulers are dropped.
+ *
+ * Raylib::runtime() is updated once per frame by the commands, see
+ * Scheduler::play(). parallel() and then() run their nested schedulers
+ * on runtimes of their own.
+ */
+final class Runtime
+{
+    // Tolerance for wake times, as clock times are sums of float frame times
+    public const EPSILON = 1e-9;
+
+    /** @var array<int, Scheduler> Schedulers updated every frame, by object id */
+    private array $active = [];
+
+    /** @var SplMinHeap<array{float, int, Scheduler}> Parked schedulers as [wake time, sequence, scheduler] */
+    private SplMinHeap $parked;
+
+    /** @var array<int, true> Ids of every scheduler on the runtime, active or parked */
+    private array $members = [];
+
+    // Orders entries with equal wake times, so schedulers are never compared
+    private int $sequence = 0;
+
+    public function __construct(
+        private ClockInterface $clock,
+    ) {
+        $this->parked = new SplMinHeap();
+    }
+
+    /**
+     * Adds a started scheduler, which the next update() advances.
+     */
+    public function add(Scheduler $scheduler): self
+    {
+        $id = spl_object_id($scheduler);
+
+        $this->members[$id] = true;
+        $this->active[$id] = $scheduler;
+
+        return $this;
+    }
+
+    /**
+     * Takes a scheduler off the runtime. A parked one stays in the heap and
+     * is dropped when its wake time comes up.
+     */
+    public function remove(Scheduler $scheduler): self
+    {
+        $id = spl_object_id($scheduler);
+
+        unset($this->members[$id], $this->active[$id]);
+
+        return $this;
+    }
+
+    public function isEmpty(): bool
+    {
+        return $this->members === [];
+    }
+
+    /**
+     * Number of schedulers on the runtime, active and parked.
+     */
+    public function count(): int
+    {
+        return count($this->members);
+    }
+
+    /**
+     * Number of schedulers the next update() resumes at least.
+     */
+    public function activeCount(): int
+    {
+        return count($this->active);
+    }
+
+    /**
+     * Wakes the parked schedulers that are due and updates every active one.
+     */
+    public function update(): void
+    {
+        $now = $this->clock->getTime() + self::EPSILON;
+
+        while (!$this->parked->isEmpty() && $this->parked->top()[0] <= $now) {
+            $scheduler = $this->parked->extract()[2];
+            $id = spl_object_id($scheduler);
+
+            if (isset($this->members[$id])) {
+                $this->active[$id] = $scheduler;
+            }
+        }
+
+        foreach ($this->active as $id => $scheduler) {
+            $scheduler->update();
+
+            if ($scheduler->isFinished()) {
+                unset($this->active[$id], $this->members[$id]);
+            } elseif (($wakeAt = $scheduler->wakeAt()) !== null) {
+                unset($this->active[$id]);
+                $this->parked->insert([$wakeAt, $this->sequence++, $scheduler]);
+            }
+        }
+    }
+
+    /**
+     * Clock time the earliest parked scheduler wakes up at, null while any
+     * scheduler is active or none is left.
+     */
+    public function nextWakeAt(): ?float
+    {
+        if ($this->active !== []) {
+            return null;
+        }
+
+        $this->prune();
+
+        return $this->parked->isEmpty() ? null : $this->parked->top()[0];
+    }
+
+    /**
+     * Seconds until an update changes anything, like Scheduler::nextUpdateIn().
+     */
+    public function nextUpdateIn(): float
+    {
+        if ($this->active !== []) {
+            return 0.0;
+        }
+
+        $wakeAt = $this->nextWakeAt();
+
+        return $wakeAt === null ? INF : max(0.0, $wakeAt - $this->clock->getTime());
+    }
+
+    /**
+     * Drops removed schedulers from the top of the heap.
+     */
+    private function prune(): void
+    {
+        while (!$this->parked->isEmpty() && !isset($this->members[spl_object_id($this->parked->top()[2])])) {
+            $this->parked->extract();
+        }
+    }
+}
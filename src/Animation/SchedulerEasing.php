@@ -0,0 +1,22 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Animation;
+
+/**
+ * The default easing of a Scheduler, shared by every track that was added
+ * without its own. Scheduler::withEasing() changes it for all of them, also
+ * the ones added before the call.
+ *
+ * @internal
+ */
+final class SchedulerEasing implements EasingFunction
+{
+    public ?EasingFunction $easing = null;
+
+    public function ease(float $t): float
+    {
+        return $this->easing === null ? $t : $this->easing->ease($t);
+    }
+}
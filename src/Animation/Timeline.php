@@ -0,0 +1,172 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Animation;
+
+use Aashan\Phpanim\Clock\ClockInterface;
+
+/**
+ * A flattened, seekable form of a Scheduler.
+ *
+ * Every track is placed at a precomputed start time, so the state at any time
+ * can be evaluated directly with seek() instead of stepping a Fiber through
+ * every frame before it. Build one with Scheduler::toTimeline().
+ */
+final class Timeline
+{
+    /** @var Track[] */
+    private array $tracks = [];
+
+    /** @var float[] */
+    private array $starts = [];
+
+    /** @var float[] */
+    private array $ends = [];
+
+    private int $count = 0;
+
+    private float $duration = 0.0;
+
+    private float $time = 0.0;
+
+    private bool $seeked = false;
+
+    private bool $compiled = false;
+
+    public function __construct(
+        private ClockInterface $clock,
+        private bool $repeat = false,
+    ) {}
+
+    public function add(float $start, Track $track): self
+    {
+        if ($this->compiled) {
+            throw new \LogicException('Cannot add tracks to a timeline that has already been evaluated.');
+        }
+
+        $this->tracks[] = $track;
+        $this->starts[] = $start;
+        $this->ends[] = $start + $track->duration();
+        $this->count++;
+        $this->duration = max($this->duration, $start + $track->duration());
+
+        return $this;
+    }
+
+    public function duration(): float
+    {
+        return $this->duration;
+    }
+
+    public function time(): float
+    {
+        return $this->time;
+    }
+
+    public function isFinished(): bool
+    {
+        return !$this->repeat && $this->seeked && $this->time >= $this->duration;
+    }
+
+    /**
+     * Advances the timeline by one frame of its clock.
+     */
+    public function update(): void
+    {
+        $this->seek($this->time + $this->clock->getFrameTime());
+    }
+
+    /**
+     * Puts every track into the state it has $time seconds into the timeline.
+     */
+    public function seek(float $time): void
+    {
+        $this->compile();
+
+        if ($this->repeat && $this->duration > 0.0) {
+            $time = fmod($time, $this->duration);
+            if ($time < 0.0) {
+                $time += $this->duration;
+            }
+        }
+
+        $time = max(0.0, $time);
+        $previous = $this->time;
+        $forward = $this->seeked && $time >= $previous;
+
+        if (!$forward) {
+            // Tracks that have not started yet go back to the state they
+            // start from, latest first so earlier tracks win.
+            for ($i = $this->count - 1; $i >= 0; $i--) {
+                if ($this->starts[$i] > $time) {
+                    $this->tracks[$i]->rewind();
+                }
+            }
+        }
+
+        for ($i = 0; $i < $this->count; $i++) {
+            if ($this->starts[$i] > $time) {
+                break;
+            }
+
+            // Moving forward, tracks that were already finished keep their final state.
+            if ($forward && $this->ends[$i] <= $previous) {
+                continue;
+            }
+
+            $this->tracks[$i]->apply(min($time - $this->starts[$i], $this->ends[$i] - $this->starts[$i]));
+        }
+
+        $this->time = $time;
+        $this->seeked = true;
+    }
+
+    /**
+     * Orders the tracks by start time and lets each of them capture the
+     * state it starts from, by replaying the timeline once, then rewinds
+     * everything back to the initial state.
+     */
+    private function compile(): void
+    {
+        if ($this->compiled) {
+            return;
+        }
+
+        $this->compiled = true;
+
+        $order = array_keys($this->tracks);
+        usort($order, fn(int $a, int $b) => $this->starts[$a] <=> $this->starts[$b] ?: $a <=> $b);
+
+        $this->tracks = array_map(fn(int $i) => $this->tracks[$i], $order);
+        $this->starts = array_map(fn(int $i) => $this->starts[$i], $order);
+        $this->ends = array_map(fn(int $i) => $this->ends[$i], $order);
+
+        $active = [];
+        for ($i = 0; $i < $this->count; $i++) {
+            $start = $this->starts[$i];
+
+            foreach ($active as $key => $j) {
+                // User callbacks are not replayed, they may have side effects.
+                if ($this->tracks[$j] instanceof CustomTrack) {
+                    unset($active[$key]);
+                    continue;
+                }
+
+                if ($this->ends[$j] <= $start) {
+                    $this->tracks[$j]->apply($this->ends[$j] - $this->starts[$j]);
+                    unset($active[$key]);
+                } else {
+                    $this->tracks[$j]->apply($start - $this->starts[$j]);
+                }
+            }
+
+            $this->tracks[$i]->begin();
+            $active[] = $i;
+        }
+
+        for ($i = $this->count - 1; $i >= 0; $i--) {
+            $this->tracks[$i]->rewind();
+        }
+    }
+}
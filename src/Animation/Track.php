@@ -0,0 +1,36 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Animation;
+
+/**
+ * A time-based animation step whose state can be evaluated at any point in time.
+ *
+ * Tracks are driven either frame by frame from a Scheduler's Fiber, or
+ * directly by a Timeline when seeking.
+ */
+interface Track
+{
+    /**
+     * Length of the track in seconds.
+     */
+    public function duration(): float;
+
+    /**
+     * Called when the track becomes active. Captures the state the track
+     * starts from, so it can be restored by rewind().
+     */
+    public function begin(): void;
+
+    /**
+     * Applies the state at $time seconds into the track. On the last frame
+     * $time may be past the duration, tracks clamp it themselves.
+     */
+    public function apply(float $time): void;
+
+    /**
+     * Restores the state captured by begin().
+     */
+    public function rewind(): void;
+}
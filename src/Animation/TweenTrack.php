@@ -0,0 +1,77 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Animation;
+
+/**
+ * Interpolates one or more numeric properties between fixed values.
+ */
+final class TweenTrack implements Track
+{
+    /** @var object[] */
+    private array $owners = [];
+
+    /** @var string[] */
+    private array $names = [];
+
+    /** @var float[] */
+    private array $starts = [];
+
+    /** @var float[] */
+    private array $deltas = [];
+
+    /** @var mixed[] */
+    private array $initial = [];
+
+    private int $count = 0;
+
+    /**
+     * @param array<string, array{float, float}> $properties Property path => [from, to]
+     */
+    public function __construct(
+        object $target,
+        array $properties,
+        private float $duration,
+        private EasingFunction $easing,
+    ) {
+        foreach ($properties as $property => [$from, $to]) {
+            $path = PropertyPath::compile($target, $property);
+            $this->owners[] = $path->owner;
+            $this->names[] = $path->property;
+            $this->starts[] = $from;
+            $this->deltas[] = $to - $from;
+        }
+
+        $this->count = count($this->owners);
+    }
+
+    public function duration(): float
+    {
+        return $this->duration;
+    }
+
+    public function begin(): void
+    {
+        for ($i = 0; $i < $this->count; $i++) {
+            $this->initial[$i] = $this->owners[$i]->{$this->names[$i]};
+        }
+    }
+
+    public function apply(float $time): void
+    {
+        $t = $this->duration > 0.0 ? min(1.0, $time / $this->duration) : 1.0;
+        $ease = $this->easing->ease($t);
+
+        for ($i = 0; $i < $this->count; $i++) {
+            $this->owners[$i]->{$this->names[$i]} = $this->starts[$i] + ($this->deltas[$i] * $ease);
+        }
+    }
+
+    public function rewind(): void
+    {
+        foreach ($this->initial as $i => $value) {
+            $this->owners[$i]->{$this->names[$i]} = $value;
+        }
+    }
+}
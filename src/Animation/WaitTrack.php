@@ -0,0 +1,32 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Animation;
+
+/**
+ * Does nothing for a while.
+ */
+final class WaitTrack implements Track
+{
+    public function __construct(
+        private float $duration,
+    ) {}
+
+    public function duration(): float
+    {
+        return $this->duration;
+    }
+
+    public function begin(): void
+    {
+    }
+
+    public function apply(float $time): void
+    {
+    }
+
+    public function rewind(): void
+    {
+    }
+}
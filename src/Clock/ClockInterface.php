@@ -0,0 +1,23 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Clock;
+
+interface ClockInterface
+{
+    /**
+     * Seconds that passed during the current frame.
+     */
+    public function getFrameTime(): float;
+
+    /**
+     * Seconds that passed since the clock started.
+     */
+    public function getTime(): float;
+
+    /**
+     * Advances the clock to the next frame. Called once at the start of every frame.
+     */
+    public function tick(): void;
+}
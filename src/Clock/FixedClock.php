@@ -0,0 +1,44 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Clock;
+
+/**
+ * Advances by exactly one fixed step per frame, independent of how long the
+ * frame actually took. Offline rendering can run as fast as the CPU allows and
+ * produces the same state for a given frame number on every run.
+ */
+final class FixedClock implements ClockInterface
+{
+    private int $frame = 0;
+
+    public function __construct(
+        private float $step = 1.0 / 60.0,
+    ) {
+        if ($step <= 0.0) {
+            throw new \InvalidArgumentException('The clock step must be greater than zero.');
+        }
+    }
+
+    public function getFrameTime(): float
+    {
+        return $this->step;
+    }
+
+    public function getTime(): float
+    {
+        // Derived from the frame count rather than accumulated, so there is no drift.
+        return $this->frame * $this->step;
+    }
+
+    public function tick(): void
+    {
+        $this->frame++;
+    }
+
+    public function getFrame(): int
+    {
+        return $this->frame;
+    }
+}
@@ -0,0 +1,66 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Clock;
+
+use Aashan\Phpanim\Raylib;
+
+/**
+ * Follows the wall clock, used for interactive rendering.
+ *
+ * Frame times are measured between ticks with GetTime() rather than taken
+ * from GetFrameTime(), so the time the render loop spends idle between two
+ * frames is counted too.
+ */
+final class RealtimeClock implements ClockInterface
+{
+    // Longest frame time reported for the first frame after an idle period
+    private const RESUMED_FRAME_TIME = 1.0 / 60.0;
+
+    private float $frameTime = 0.0;
+
+    private float $time = 0.0;
+
+    // GetTime() at the previous tick
+    private ?float $last = null;
+
+    private bool $resumed = false;
+
+    public function __construct(
+        private Raylib $rl,
+    ) {}
+
+    public function getFrameTime(): float
+    {
+        return $this->frameTime;
+    }
+
+    public function getTime(): float
+    {
+        return $this->time;
+    }
+
+    public function tick(): void
+    {
+        $now = $this->rl->GetTime();
+        $elapsed = $this->last === null ? $this->rl->GetFrameTime() : $now - $this->last;
+
+        $this->frameTime = $this->resumed ? min($elapsed, self::RESUMED_FRAME_TIME) : $elapsed;
+        $this->resumed = false;
+        $this->last = $now;
+        $this->time += $elapsed;
+    }
+
+    /**
+     * Called when the render loop wakes up from idling. The next tick still
+     * moves the time past the idle period, so waits end when they should,
+     * but reports at most one frame as its frame time. Otherwise a tween
+     * started on that frame, e.g. in response to the input that woke the
+     * loop, would advance by the whole idle period and jump to its end.
+     */
+    public function resume(): void
+    {
+        $this->resumed = true;
+    }
+}
@@ -4,7 +4,10 @@ declare(strict_types=1);
 
 namespace Aashan\Phpanim\Commands;
 
+use Aashan\Phpanim\Drawing\DrawList;
 use Aashan\Phpanim\Plugins\PluginManager;
+use Aashan\Phpanim\Profiling\CountingRaylib;
+use Aashan\Phpanim\Profiling\Profiler;
 use Aashan\Phpanim\Raylib;
 use Symfony\Component\Console\Command\Command as SymfonyCommand;
 use Symfony\Component\Console\Input\InputInterface;
@@ -16,6 +19,9 @@ abstract class Command extends SymfonyCommand
     protected Raylib $rl;
     protected PluginManager $pluginManager;
 
+    // Whether the profiler draws its HUD on top of the frames
+    protected bool $profilerHud = true;
+
     abstract public function handle(InputInterface $input, OutputInterface $output): int;
 
     public function execute(InputInterface $input, OutputInterface $output): int
@@ -41,11 +47,34 @@ abstract class Command extends SymfonyCommand
             return Command::FAILURE;
         }
 
-        $definition = file_get_contents($definitionPath);
+        $tracePath = $input->getOption('profile-output');
+        $profiling = $input->getOption('profile') || $tracePath !== null;
+
+        $started = hrtime(true);
+
+        // The counting binding is only swapped in while profiling, so normal runs pay nothing for it
+        $class = $profiling ? CountingRaylib::class : Raylib::class;
+
+        // The preloaded definitions are only used when no other library or header was asked for
+        $preloaded = !$input->hasParameterOption(['--raylib-dll-path', '-r', '--raylib-definition-path', '-d'])
+            && Raylib::isPreloaded();
 
-        $this->rl = new Raylib($dllPath, $definition);
+        $this->rl = $preloaded
+            ? $class::fromScope()
+            : new $class($dllPath, file_get_contents($definitionPath));
+        $this->rl->useDrawList(new DrawList($this->rl, $input->getOption('draw-shim-path')));
 
-        $this->pluginManager = new PluginManager($pluginPath);
+        $bound = hrtime(true);
+
+        if ($profiling) {
+            $this->rl->useProfiler(new Profiler($this->rl, $tracePath, $this->profilerHud));
+        }
+
+        $this->pluginManager = new PluginManager($pluginPath, $input->getOption('plugin-manifest'));
+
+        if ($output->isVerbose()) {
+            $this->reportStartup($io, $started, $bound, $preloaded);
+        }
 
         try {
             $status = $this->handle($input, $io);
@@ -54,7 +83,74 @@ abstract class Command extends SymfonyCommand
             $status = Command::FAILURE;
         } finally {
             $this->pluginManager->unregister($this->rl);
+            $this->rl->profiler()?->close();
+        }
+
+        if ($profiling) {
+            $this->reportProfile($this->rl->profiler(), $io, $tracePath);
         }
+
         return $status;
     }
+
+    /**
+     * Advances the clock, clears the current render target, runs one
+     * update of the shared runtime and of every plugin and executes the
+     * draw calls they batched.
+     */
+    protected function renderFrame(): void
+    {
+        $profiler = $this->rl->profiler();
+        $profiler?->beginFrame();
+
+        $this->rl->clock()->tick();
+
+        $this->rl->ClearBackground($this->rl->color(0xFFFFFFFF));
+
+        $profiler?->begin('runtime', 'scheduler');
+        $this->rl->runtime()->update();
+        $profiler?->end();
+
+        $this->pluginManager->update($this->rl);
+        $this->rl->drawList()->flush();
+
+        $profiler?->endFrame();
+        $profiler?->drawHud();
+    }
+
+    /**
+     * Prints how long getting to the first frame took, compare runs with and
+     * without preloading or the plugin manifest to see what they save.
+     */
+    private function reportStartup(SymfonyStyle $io, int $started, int $bound, bool $preloaded): void
+    {
+        $now = hrtime(true);
+
+        $io->writeln(sprintf(
+            'Startup: %.2f ms since the process started, raylib binding %.2f ms (%s), plugins %.2f ms (%s)',
+            (microtime(true) - $_SERVER['REQUEST_TIME_FLOAT']) * 1e3,
+            ($bound - $started) / 1e6,
+            $preloaded ? 'preloaded' : 'header parsed',
+            ($now - $bound) / 1e6,
+            $this->pluginManager->isFromManifest() ? 'manifest' : 'scanned',
+        ));
+    }
+
+    private function reportProfile(Profiler $profiler, SymfonyStyle $io, ?string $tracePath): void
+    {
+        if ($profiler->frames() > 0) {
+            $io->section(sprintf('Profile (average per frame over %d frames)', $profiler->frames()));
+            $io->table(
+                ['Span', 'Category', 'ms', 'Count'],
+                array_map(
+                    static fn(array $row) => [$row[0], $row[1], sprintf('%.3f', $row[2]), sprintf('%.1f', $row[3])],
+                    $profiler->summary(),
+                ),
+            );
+        }
+
+        if ($tracePath !== null) {
+            $io->writeln("Trace written to {$tracePath}");
+        }
+    }
 }
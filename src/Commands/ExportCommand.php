@@ -4,20 +4,561 @@ declare(strict_types=1);
 
 namespace Aashan\Phpanim\Commands;
 
+use Aashan\Phpanim\Clock\FixedClock;
 use Aashan\Phpanim\Commands\Command;
+use Aashan\Phpanim\Export\FfmpegEncoder;
+use Aashan\Phpanim\Export\Fingerprint;
+use Aashan\Phpanim\Export\FrameCapture;
+use Aashan\Phpanim\Export\SegmentCache;
+use Aashan\Phpanim\Plugins\SceneManagerPlugin;
+use Aashan\Phpanim\Raylib;
+use Symfony\Component\Console\Helper\ProgressBar;
+use Symfony\Component\Console\Helper\Table;
 use Symfony\Component\Console\Input\InputInterface;
+use Symfony\Component\Console\Input\InputOption;
 use Symfony\Component\Console\Output\OutputInterface;
+use Symfony\Component\Finder\Finder;
 
 final class ExportCommand extends Command
 {
+    // The HUD would end up in the video
+    protected bool $profilerHud = false;
+
+    private int $width;
+    private int $height;
+    private int $fps;
+    private string $codec;
+    private string $ffmpeg;
+
     protected function configure(): void
     {
         $this->setName('export');
         $this->setDescription('Exports the animation into video using ffmpeg.');
+
+        $this->addOption('output', 'o', InputOption::VALUE_REQUIRED, 'Path of the video file to write', 'output.mp4');
+        $this->addOption('width', null, InputOption::VALUE_REQUIRED, 'Width of the exported video in pixels', '1600');
+        $this->addOption('height', null, InputOption::VALUE_REQUIRED, 'Height of the exported video in pixels', '900');
+        $this->addOption('fps', null, InputOption::VALUE_REQUIRED, 'Frames per second of the exported video', '60');
+        $this->addOption('duration', null, InputOption::VALUE_REQUIRED, 'Length of the animation in seconds', '10');
+        $this->addOption('start-frame', null, InputOption::VALUE_REQUIRED, 'First frame to write to the video', '0');
+        $this->addOption('end-frame', null, InputOption::VALUE_REQUIRED, 'Frame to stop at (exclusive), overrides --duration');
+        $this->addOption('codec', null, InputOption::VALUE_REQUIRED, 'ffmpeg video codec', 'libx264');
+        $this->addOption('ffmpeg', null, InputOption::VALUE_REQUIRED, 'Path to the ffmpeg binary', 'ffmpeg');
+        $this->addOption('jobs', 'j', InputOption::VALUE_REQUIRED, 'Number of worker processes rendering in parallel', '1');
+        $this->addOption('cache-dir', null, InputOption::VALUE_REQUIRED, 'Directory to cache encoded scenes in, unchanged scenes are reused from it');
+        $this->addOption('cache-size', null, InputOption::VALUE_REQUIRED, 'Size cap of the cache directory in megabytes', '2048');
     }
 
     public function handle(InputInterface $input, OutputInterface $output): int
     {
+        $this->width = (int) $input->getOption('width');
+        $this->height = (int) $input->getOption('height');
+        $this->fps = (int) $input->getOption('fps');
+        $this->codec = $input->getOption('codec');
+        $this->ffmpeg = $input->getOption('ffmpeg');
+
+        $jobs = (int) $input->getOption('jobs');
+        $startFrame = (int) $input->getOption('start-frame');
+        $endFrame = $input->getOption('end-frame') !== null
+            ? (int) $input->getOption('end-frame')
+            : (int) round((float) $input->getOption('duration') * $this->fps);
+
+        if ($this->width <= 0 || $this->height <= 0 || $this->fps <= 0 || $jobs <= 0) {
+            throw new \InvalidArgumentException('Width, height, fps and jobs must be positive integers.');
+        }
+
+        if ($startFrame < 0 || $endFrame <= $startFrame) {
+            throw new \InvalidArgumentException("Invalid frame range [{$startFrame}, {$endFrame}).");
+        }
+
+        $jobs = min($jobs, $endFrame - $startFrame);
+
+        if ($input->getOption('cache-dir') !== null) {
+            if ($jobs > 1) {
+                throw new \InvalidArgumentException('The export cache can not be combined with parallel workers yet.');
+            }
+
+            $cache = new SegmentCache(
+                $input->getOption('cache-dir'),
+                (int) $input->getOption('cache-size') * 1024 * 1024,
+                pathinfo($input->getOption('output'), PATHINFO_EXTENSION) ?: 'mp4',
+            );
+
+            $progress = new ProgressBar($output, $endFrame - $startFrame);
+            $reused = $this->renderCached($startFrame, $endFrame, $input->getOption('output'), $cache, $this->libraryFingerprint($input), $progress);
+            $progress->finish();
+            $output->writeln('');
+            $output->writeln(sprintf('Reused %d of %d frames from the cache.', $reused, $endFrame - $startFrame));
+
+            return Command::SUCCESS;
+        }
+
+        if ($jobs === 1) {
+            $progress = new ProgressBar($output, $endFrame - $startFrame);
+            $this->renderSegment($startFrame, $endFrame, $input->getOption('output'), $progress);
+            $progress->finish();
+            $output->writeln('');
+
+            return Command::SUCCESS;
+        }
+
+        return $this->renderParallel($jobs, $startFrame, $endFrame, $input->getOption('output'), $output);
+    }
+
+    /**
+     * Renders the frames [$startFrame, $endFrame) into a video file.
+     *
+     * Frames before $startFrame still have to be simulated so the scenes
+     * reach the right state, but nothing is drawn for them, see skipFrame().
+     */
+    private function renderSegment(int $startFrame, int $endFrame, string $path, ?ProgressBar $progress = null): void
+    {
+        $this->openWindow();
+
+        $capture = new FrameCapture($this->rl, $this->width, $this->height);
+        $encoder = $this->encoder($path);
+
+        try {
+            $encoder->open();
+
+            for ($frame = 0; $frame < $startFrame; $frame++) {
+                $this->skipFrame();
+            }
+
+            for ($frame = $startFrame; $frame < $endFrame; $frame++) {
+                $pixels = $this->captureFrame($capture, true);
+
+                if ($pixels !== null) {
+                    $encoder->write($pixels);
+                    $progress?->advance();
+                }
+            }
+
+            $pixels = $capture->flush();
+            if ($pixels !== null) {
+                $encoder->write($pixels);
+                $progress?->advance();
+            }
+        } finally {
+            $capture->release();
+            $encoder->close();
+            $this->rl->CloseWindow();
+        }
+    }
+
+    /**
+     * Renders the frames [$startFrame, $endFrame) one scene at a time, every
+     * scene into its own cached segment, and joins the segments into a video.
+     *
+     * A segment is keyed on the fingerprint of its scene, of the other
+     * plugins, of the library rendering it and of the export settings, and
+     * on the frame it starts at.
+     * When the key is in the cache the scene is skipped: its frames still
+     * pass so the other plugins and the clock stay in step, but the scene is
+     * not updated and nothing is read back or encoded.
+     *
+     * @return int Number of frames taken from the cache
+     */
+    private function renderCached(int $startFrame, int $endFrame, string $path, SegmentCache $cache, string $library, ProgressBar $progress): int
+    {
+        $scenes = $this->sceneManager();
+        $keys = $this->segmentKeys($scenes, $library);
+
+        $this->openWindow();
+
+        $capture = new FrameCapture($this->rl, $this->width, $this->height);
+        $encoder = null;
+
+        $segment = null;
+        $files = [];
+        $reused = 0;
+
+        try {
+            $frame = 0;
+
+            while ($frame < $endFrame) {
+                if ($frame < $startFrame) {
+                    $this->skipFrame();
+                    $frame++;
+                    continue;
+                }
+
+                $name = $scenes?->current($this->rl);
+
+                if ($segment === null || $name !== $segment['name']) {
+                    if ($segment !== null) {
+                        $files[] = $this->closeSegment($segment, $frame, true, $capture, $encoder, $cache, $progress);
+                        $segment = $encoder = null;
+                    }
+
+                    $key = hash('xxh128', implode(':', [$keys['base'], $name ?? '', $keys['scenes'][$name] ?? '', $frame]));
+                    $entry = $cache->get($key);
+
+                    // Segments cut short by the end of an export only fit exports ending at the same frame
+                    $fits = $entry !== null && ($entry['complete']
+                        ? $frame + $entry['frames'] <= $endFrame
+                        : $frame + $entry['frames'] === $endFrame);
+
+                    if ($fits) {
+                        if ($name !== null) {
+                            $scenes->skip($name, $entry['frames']);
+                        }
+
+                        for ($i = 0; $i < $entry['frames']; $i++) {
+                            $this->skipFrame();
+                        }
+
+                        $files[] = $entry['path'];
+                        $frame += $entry['frames'];
+                        $reused += $entry['frames'];
+                        $progress->advance($entry['frames']);
+                        continue;
+                    }
+
+                    $segment = ['key' => $key, 'name' => $name, 'start' => $frame, 'file' => $cache->reserve($key)];
+                    $encoder = $this->encoder($segment['file']);
+                    $encoder->open();
+                }
+
+                $pixels = $this->captureFrame($capture, true);
+                if ($pixels !== null) {
+                    $encoder->write($pixels);
+                    $progress->advance();
+                }
+
+                $frame++;
+            }
+
+            if ($segment !== null) {
+                $files[] = $this->closeSegment($segment, $frame, false, $capture, $encoder, $cache, $progress);
+                $segment = $encoder = null;
+            }
+        } finally {
+            $capture->release();
+            $encoder?->close();
+            $this->rl->CloseWindow();
+
+            if ($segment !== null) {
+                @unlink($segment['file']);
+            }
+        }
+
+        if (count($files) === 1) {
+            copy($files[0], $path);
+        } else {
+            FfmpegEncoder::concat($this->ffmpeg, $files, $path);
+        }
+
+        $cache->evict();
+
+        return $reused;
+    }
+
+    /**
+     * Writes the last frame of a segment, finishes encoding it and moves it
+     * into the cache.
+     */
+    private function closeSegment(
+        array $segment,
+        int $frame,
+        bool $complete,
+        FrameCapture $capture,
+        FfmpegEncoder $encoder,
+        SegmentCache $cache,
+        ProgressBar $progress,
+    ): string {
+        $pixels = $capture->flush();
+        if ($pixels !== null) {
+            $encoder->write($pixels);
+            $progress->advance();
+        }
+
+        $encoder->close();
+
+        return $cache->put($segment['key'], $segment['file'], $frame - $segment['start'], $complete);
+    }
+
+    /**
+     * Fingerprints the export settings and the plugins, and every scene of
+     * the scene manager separately, before anything is loaded.
+     *
+     * What scenes build in load() is not hashed with them, it is covered by
+     * $library, see libraryFingerprint().
+     *
+     * @return array{base: string, scenes: array<string, string>}
+     */
+    private function segmentKeys(?SceneManagerPlugin $scenes, string $library): array
+    {
+        $base = new Fingerprint()->add([$library, $this->width, $this->height, $this->fps, $this->codec]);
+
+        foreach ($this->pluginManager->getPlugins() as $name => $plugin) {
+            // Scenes are keyed on their own, so editing one leaves the others cached
+            if ($plugin === $scenes) {
+                $base->add($name)->addClass($plugin::class);
+            } else {
+                $base->add($name)->add($plugin);
+            }
+
+            $file = $this->pluginManager->getFile($name);
+            if ($file !== null) {
+                $base->addFile($file);
+            }
+        }
+
+        return [
+            'base' => $base->hash(),
+            'scenes' => array_map(
+                static fn(object $scene) => new Fingerprint()->add($scene)->hash(),
+                $scenes?->getScenes() ?? [],
+            ),
+        ];
+    }
+
+    /**
+     * Hashes everything that renders and encodes the frames besides the
+     * plugins: PHPAnim's own source, which covers the visualizations scenes
+     * build in load() and the generated binding, the raylib header and
+     * library, the draw shim and the ffmpeg build.
+     */
+    private function libraryFingerprint(InputInterface $input): string
+    {
+        $fingerprint = new Fingerprint();
+
+        $finder = new Finder();
+        $finder->files()->in(dirname(__DIR__))->name('*.php')->sortByName();
+
+        foreach ($finder as $file) {
+            $fingerprint->addFile($file->getRealPath());
+        }
+
+        $fingerprint
+            ->addFile($input->getOption('raylib-definition-path'))
+            ->addFile($input->getOption('raylib-dll-path'))
+            ->addFile(dirname(__DIR__, 2) . '/lib/phpanim_draw.h');
+
+        $shim = $input->getOption('draw-shim-path');
+        if ($this->rl->drawList()->isNative() && $shim !== null) {
+            $fingerprint->addFile($shim);
+        }
+
+        return $fingerprint
+            ->add($this->rl->drawList()->isNative())
+            ->add(FfmpegEncoder::version($this->ffmpeg))
+            ->hash();
+    }
+
+    private function sceneManager(): ?SceneManagerPlugin
+    {
+        foreach ($this->pluginManager->getPlugins() as $plugin) {
+            if ($plugin instanceof SceneManagerPlugin) {
+                return $plugin;
+            }
+        }
+
+        return null;
+    }
+
+    private function openWindow(): void
+    {
+        $this->rl->SetConfigFlags(Raylib::FLAG_WINDOW_HIDDEN);
+        $this->rl->InitWindow($this->width, $this->height, 'Phpanim Export');
+
+        // Animations advance by exactly one frame of video per loop, so the
+        // export is deterministic and not throttled to real time.
+        $this->rl->SetTargetFPS(0);
+        $this->rl->useClock(new FixedClock(1.0 / $this->fps));
+
+        $this->pluginManager->initialize($this->rl);
+    }
+
+    private function encoder(string $path): FfmpegEncoder
+    {
+        return new FfmpegEncoder(
+            binary: $this->ffmpeg,
+            output: $path,
+            width: $this->width,
+            height: $this->height,
+            fps: $this->fps,
+            codec: $this->codec,
+        );
+    }
+
+    /**
+     * Renders one frame and returns the pixels of the previously captured one.
+     */
+    private function captureFrame(FrameCapture $capture, bool $read): ?string
+    {
+        $this->rl->BeginDrawing();
+        $capture->begin();
+        $this->renderFrame();
+        $pixels = $capture->end($read);
+        $this->rl->EndDrawing();
+
+        return $pixels;
+    }
+
+    /**
+     * Advances the clock, the runtime and the plugins by one frame like
+     * renderFrame(), without drawing it: the target is not cleared, nothing
+     * is bound, read back or presented, and the batched draw calls are
+     * thrown away. Used to reach the state of a later frame cheaply.
+     */
+    private function skipFrame(): void
+    {
+        $profiler = $this->rl->profiler();
+        $profiler?->beginFrame();
+
+        $this->rl->clock()->tick();
+
+        $profiler?->begin('runtime', 'scheduler');
+        $this->rl->runtime()->update();
+        $profiler?->end();
+
+        $this->pluginManager->update($this->rl);
+        $this->rl->drawList()->clear();
+
+        $profiler?->endFrame();
+    }
+
+    /**
+     * Splits the frame range into contiguous shards, renders each one in a
+     * forked worker with its own hidden raylib context and joins the
+     * resulting segments without re-encoding them.
+     */
+    private function renderParallel(int $jobs, int $startFrame, int $endFrame, string $path, OutputInterface $output): int
+    {
+        if (!function_exists('pcntl_fork')) {
+            throw new \RuntimeException('Parallel export requires the pcntl extension.');
+        }
+
+        $directory = sys_get_temp_dir() . '/phpanim-export-' . getmypid() . '-' . bin2hex(random_bytes(4));
+        if (!mkdir($directory, 0777, true)) {
+            throw new \RuntimeException("Unable to create the segment directory {$directory}.");
+        }
+
+        $extension = pathinfo($path, PATHINFO_EXTENSION) ?: 'mp4';
+        $total = $endFrame - $startFrame;
+        $workers = [];
+
+        $output->writeln(sprintf('Rendering %d frames on %d workers...', $total, $jobs));
+        $started = microtime(true);
+
+        try {
+            for ($worker = 0; $worker < $jobs; $worker++) {
+                $first = $startFrame + intdiv($total * $worker, $jobs);
+                $last = $startFrame + intdiv($total * ($worker + 1), $jobs);
+                $segment = sprintf('%s/segment-%03d.%s', $directory, $worker, $extension);
+
+                $pid = pcntl_fork();
+
+                if ($pid === -1) {
+                    $this->stopWorkers($workers);
+                    throw new \RuntimeException('Unable to fork an export worker.');
+                }
+
+                if ($pid === 0) {
+                    $this->runWorker($first, $last, $segment);
+                }
+
+                $workers[$worker] = ['pid' => $pid, 'first' => $first, 'last' => $last, 'segment' => $segment];
+            }
+
+            $failed = false;
+            foreach ($workers as $worker => $info) {
+                pcntl_waitpid($info['pid'], $status);
+
+                if (!pcntl_wifexited($status) || pcntl_wexitstatus($status) !== 0) {
+                    $output->writeln("<error>Worker {$worker} failed.</error>");
+                    $failed = true;
+                }
+            }
+
+            if ($failed) {
+                return Command::FAILURE;
+            }
+
+            FfmpegEncoder::concat($this->ffmpeg, array_column($workers, 'segment'), $path);
+
+            $this->rl->profiler()?->merge(array_map(
+                static fn(string $segment) => $segment . '.trace',
+                array_column($workers, 'segment'),
+            ));
+
+            $this->reportThroughput($workers, $total, microtime(true) - $started, $output);
+        } finally {
+            // Workers exit() without unwinding, so only the parent gets here
+            array_map('unlink', glob($directory . '/*') ?: []);
+            rmdir($directory);
+        }
+
         return Command::SUCCESS;
     }
+
+    /**
+     * Terminates and reaps the workers already started, so a failed fork
+     * leaves neither running renders nor zombies behind.
+     *
+     * @param array<int, array{pid: int}> $workers
+     */
+    private function stopWorkers(array $workers): void
+    {
+        foreach ($workers as $info) {
+            if (function_exists('posix_kill')) {
+                posix_kill($info['pid'], SIGTERM);
+            }
+
+            pcntl_waitpid($info['pid'], $status);
+        }
+    }
+
+    /**
+     * Body of a forked worker. Every worker skips through the frames before
+     * its shard with the same fixed clock, so it reaches exactly the
+     * state a serial export would have at that frame.
+     */
+    private function runWorker(int $first, int $last, string $segment): never
+    {
+        $status = Command::SUCCESS;
+        $started = microtime(true);
+
+        try {
+            // Workers trace into their own file, the parent merges them afterwards
+            $this->rl->profiler()?->redirect($segment . '.trace', "export worker [{$first}, {$last})");
+
+            $this->renderSegment($first, $last, $segment);
+
+            file_put_contents($segment . '.json', json_encode([
+                'frames' => $last - $first,
+                'seconds' => microtime(true) - $started,
+            ]));
+        } catch (\Throwable $e) {
+            fwrite(STDERR, "Export worker for frames [{$first}, {$last}) failed: {$e->getMessage()}\n");
+            $status = Command::FAILURE;
+        }
+
+        $this->pluginManager->unregister($this->rl);
+        $this->rl->profiler()?->close();
+
+        exit($status);
+    }
+
+    private function reportThroughput(array $workers, int $total, float $elapsed, OutputInterface $output): void
+    {
+        $table = new Table($output);
+        $table->setHeaders(['Worker', 'Frames', 'Seconds', 'FPS']);
+
+        foreach ($workers as $worker => $info) {
+            $stats = json_decode((string) file_get_contents($info['segment'] . '.json'), true);
+
+            $table->addRow([
+                $worker,
+                sprintf('%d-%d', $info['first'], $info['last'] - 1),
+                sprintf('%.2f', $stats['seconds']),
+                sprintf('%.1f', $stats['frames'] / max($stats['seconds'], 1e-9)),
+            ]);
+        }
+
+        $table->addRow(['total', $total, sprintf('%.2f', $elapsed), sprintf('%.1f', $total / max($elapsed, 1e-9))]);
+        $table->render();
+    }
 }
@@ -4,16 +4,27 @@ declare(strict_types=1);
 
 namespace Aashan\Phpanim\Commands;
 
+use Aashan\Phpanim\Clock\RealtimeClock;
 use Aashan\Phpanim\Commands\Command;
 use Symfony\Component\Console\Input\InputInterface;
+use Symfony\Component\Console\Input\InputOption;
 use Symfony\Component\Console\Output\OutputInterface;
 
 final class RenderCommand extends Command
 {
+    // Longest sleep between two input polls while waiting for a timed animation
+    private const IDLE_SLICE = 0.05;
+
+    // KEY_SPACE up to KEY_KB_MENU, the range raylib has key codes in
+    private const FIRST_KEY = 32;
+    private const LAST_KEY = 348;
+
     protected function configure(): void
     {
         $this->setName('render');
         $this->setDescription('Renders the animation.');
+
+        $this->addOption('no-idle', null, InputOption::VALUE_NONE, 'Redraw every frame, even when nothing changes');
     }
 
     public function handle(InputInterface $input, OutputInterface $output): int
@@ -22,21 +33,87 @@ final class RenderCommand extends Command
 
         $this->pluginManager->initialize($this->rl);
 
+        // The profiler measures frames, idling would leave it with nothing to measure
+        $idle = !$input->getOption('no-idle') && $this->rl->profiler() === null;
+
         while (!$this->rl->WindowShouldClose()) {
             $this->rl->BeginDrawing();
-            $this->rl->ClearBackground($this->rl->struct('Color', [
-                'r' => 255,
-                'g' => 255,
-                'b' => 255,
-                'a' => 255,
-            ]));
-
-            $this->pluginManager->update($this->rl);
-
+            $this->renderFrame();
             $this->rl->EndDrawing();
+
+            // The idle period is not one frame of animation, see RealtimeClock::resume()
+            if ($idle && $this->idle() && ($clock = $this->rl->clock()) instanceof RealtimeClock) {
+                $clock->resume();
+            }
         }
 
         $this->rl->CloseWindow();
         return Command::SUCCESS;
     }
+
+    /**
+     * Keeps the frame just presented on screen for as long as no plugin has
+     * anything to change, instead of drawing it again.
+     *
+     * Returns when the next timed animation is due, or on input or a resize,
+     * which plugins may react to. With nothing scheduled at all it blocks
+     * until the next input event. Returns whether it waited at all.
+     */
+    private function idle(): bool
+    {
+        $wait = min($this->pluginManager->nextUpdateIn($this->rl), $this->rl->runtime()->nextUpdateIn());
+
+        if ($wait <= 0.0) {
+            return false;
+        }
+
+        if ($wait === INF) {
+            $this->rl->EnableEventWaiting();
+            $this->rl->PollInputEvents();
+            $this->rl->DisableEventWaiting();
+            return true;
+        }
+
+        // raylib cannot wait for input with a timeout, so sleep in slices and poll in between
+        $due = $this->rl->GetTime() + $wait;
+
+        while (($left = $due - $this->rl->GetTime()) > 0.0) {
+            $this->rl->WaitTime(min($left, self::IDLE_SLICE));
+            $this->rl->PollInputEvents();
+
+            if ($this->rl->WindowShouldClose() || $this->rl->IsWindowResized() || $this->inputReceived()) {
+                return true;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * Whether the last poll saw any input. Only checks that leave the input
+     * state as it is, GetKeyPressed() would take the key away from plugins.
+     */
+    private function inputReceived(): bool
+    {
+        $mouse = $this->rl->GetMouseDelta();
+
+        if ($mouse->x !== 0.0 || $mouse->y !== 0.0 || $this->rl->GetMouseWheelMove() !== 0.0) {
+            return true;
+        }
+
+        // Left, right and middle button
+        for ($button = 0; $button <= 2; $button++) {
+            if ($this->rl->IsMouseButtonPressed($button)) {
+                return true;
+            }
+        }
+
+        for ($key = self::FIRST_KEY; $key <= self::LAST_KEY; $key++) {
+            if ($this->rl->IsKeyPressed($key)) {
+                return true;
+            }
+        }
+
+        return false;
+    }
 }
@@ -0,0 +1,392 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Drawing;
+
+use Aashan\Phpanim\Raylib;
+use Countable;
+use FFI;
+use FFI\CData;
+
+/**
+ * Records draw calls into a packed command buffer and executes them in one go.
+ *
+ * With the native shim (lib/phpanim_draw.c) built, flush() is a single FFI
+ * call no matter how many commands were recorded. Without it the commands
+ * are replayed through Raylib one by one, so the output is the same either
+ * way, only slower.
+ *
+ * Draw calls made through Raylib's methods flush the list first, see
+ * Raylib::FLUSHES_DRAW_LIST, so list and direct draws end up in the order
+ * they were made. Calls on $rl->ffi bypass that, flush before making them.
+ */
+final class DrawList implements Countable
+{
+    // Keep in sync with PhpanimDrawOp in lib/phpanim_draw.h
+    public const LINE = 1;
+    public const LINE_EX = 2;
+    public const RECTANGLE = 3;
+    public const CIRCLE = 4;
+    public const TRIANGLE = 5;
+    public const TEXT = 6;
+    public const SPLINE_LINEAR = 7;
+    public const SPLINE_CATMULL_ROM = 8;
+    public const POINTS = 9;
+    public const TEXT_EX = 10;
+
+    private FFI $ffi;
+    private bool $native;
+
+    private CData $commands;
+    private int $capacity;
+    private int $count = 0;
+
+    // NUL separated strings referenced by text commands
+    private CData $text;
+    private int $textCapacity;
+    private int $textUsed = 0;
+
+    /** @var CData[] Buffers referenced by pending commands, kept alive until the flush */
+    private array $owners = [];
+
+    // Times the list was emptied
+    private int $generation = 0;
+
+    // Set while replaying, the Raylib calls made for the commands would flush again
+    private bool $flushing = false;
+
+    public function __construct(
+        private Raylib $rl,
+        ?string $library = null, // Path to the built shim, replays in PHP when missing
+        int $capacity = 1024,
+    ) {
+        $definition = file_get_contents(__DIR__ . '/../../lib/phpanim_draw.h');
+
+        $this->native = $library !== null && file_exists($library);
+        // Without the library only the command types are needed, the prototypes would fail to resolve
+        $this->ffi = $this->native ? FFI::cdef($definition, $library) : FFI::cdef(Raylib::typesOnly($definition));
+
+        $this->capacity = max($capacity, 16);
+        $this->commands = $this->ffi->new("PhpanimDrawCommand[{$this->capacity}]");
+
+        $this->textCapacity = 16 * $this->capacity;
+        $this->text = $this->ffi->new("char[{$this->textCapacity}]");
+    }
+
+    public function isNative(): bool
+    {
+        return $this->native;
+    }
+
+    public function count(): int
+    {
+        return $this->count;
+    }
+
+    /**
+     * Counts up every time the list is flushed or cleared. A caller that
+     * remembers it after recording can tell whether its commands are still
+     * pending, e.g. before rewriting a buffer they point into.
+     */
+    public function generation(): int
+    {
+        return $this->generation;
+    }
+
+    /**
+     * The loaded shim, for the bulk kernels it exports next to the executor.
+     * Null when the list replays in PHP.
+     */
+    public function shim(): ?FFI
+    {
+        return $this->native ? $this->ffi : null;
+    }
+
+    public function line(float $startX, float $startY, float $endX, float $endY, int $color): void
+    {
+        $args = $this->push(self::LINE, $color)->args;
+        $args[0] = $startX;
+        $args[1] = $startY;
+        $args[2] = $endX;
+        $args[3] = $endY;
+    }
+
+    public function lineEx(float $startX, float $startY, float $endX, float $endY, float $thick, int $color): void
+    {
+        $args = $this->push(self::LINE_EX, $color)->args;
+        $args[0] = $startX;
+        $args[1] = $startY;
+        $args[2] = $endX;
+        $args[3] = $endY;
+        $args[4] = $thick;
+    }
+
+    public function rectangle(float $x, float $y, float $width, float $height, int $color): void
+    {
+        $args = $this->push(self::RECTANGLE, $color)->args;
+        $args[0] = $x;
+        $args[1] = $y;
+        $args[2] = $width;
+        $args[3] = $height;
+    }
+
+    public function circle(float $centerX, float $centerY, float $radius, int $color): void
+    {
+        $args = $this->push(self::CIRCLE, $color)->args;
+        $args[0] = $centerX;
+        $args[1] = $centerY;
+        $args[2] = $radius;
+    }
+
+    public function triangle(float $x1, float $y1, float $x2, float $y2, float $x3, float $y3, int $color): void
+    {
+        $args = $this->push(self::TRIANGLE, $color)->args;
+        $args[0] = $x1;
+        $args[1] = $y1;
+        $args[2] = $x2;
+        $args[3] = $y2;
+        $args[4] = $x3;
+        $args[5] = $y3;
+    }
+
+    public function text(string $text, float $posX, float $posY, int $fontSize, int $color): void
+    {
+        $command = $this->pushText(self::TEXT, $text, $color);
+        $command->args[0] = $posX;
+        $command->args[1] = $posY;
+        $command->args[2] = $fontSize;
+    }
+
+    /**
+     * Text in a loaded font. The font is referenced, not copied, it must stay
+     * loaded until the list is flushed.
+     */
+    public function textEx(CData $font, string $text, float $posX, float $posY, float $fontSize, float $spacing, int $color): void
+    {
+        $command = $this->pushText(self::TEXT_EX, $text, $color);
+        $command->args[0] = $posX;
+        $command->args[1] = $posY;
+        $command->args[2] = $fontSize;
+        $command->args[3] = $spacing;
+        $command->points = FFI::addr($font);
+    }
+
+    /**
+     * The points are referenced, not copied, they must stay unchanged until
+     * the list is flushed. When $points points into a larger array, pass
+     * that array as $owner so it stays alive until then.
+     */
+    public function splineLinear(CData $points, int $pointCount, float $thick, int $color, ?CData $owner = null): void
+    {
+        $this->owners[] = $owner ?? $points;
+
+        $command = $this->push(self::SPLINE_LINEAR, $color);
+        $command->args[0] = $thick;
+        $command->count = $pointCount;
+        $command->points = $points;
+    }
+
+    /**
+     * Like splineLinear(), the points must stay alive and unchanged until
+     * the list is flushed.
+     */
+    public function splineCatmullRom(CData $points, int $pointCount, float $thick, int $color, ?CData $owner = null): void
+    {
+        $this->owners[] = $owner ?? $points;
+
+        $command = $this->push(self::SPLINE_CATMULL_ROM, $color);
+        $command->args[0] = $thick;
+        $command->count = $pointCount;
+        $command->points = $points;
+    }
+
+    /**
+     * Draws $count squares of $size pixels centred on the graph space points
+     * ($x[i], $y[i]), mapped to the screen like the grid and curves do.
+     *
+     * The arrays are referenced, not copied, they must stay unchanged until
+     * the list is flushed.
+     */
+    public function points(CData $x, CData $y, CData $colors, int $count, float $size, float $originX, float $originY, float $unitSize): void
+    {
+        $points = $this->ffi->new('PhpanimPoints');
+        $points->x = $this->ffi->cast('const float *', FFI::addr($x[0]));
+        $points->y = $this->ffi->cast('const float *', FFI::addr($y[0]));
+        $points->colors = $this->ffi->cast('const unsigned int *', FFI::addr($colors[0]));
+        $this->owners[] = $points;
+
+        $command = $this->push(self::POINTS, 0);
+        $command->args[0] = $size;
+        $command->args[1] = $originX;
+        $command->args[2] = $originY;
+        $command->args[3] = $unitSize;
+        $command->count = $count;
+        $command->points = FFI::addr($points);
+    }
+
+    /**
+     * Executes every recorded command in order and empties the list.
+     */
+    public function flush(): void
+    {
+        if ($this->count === 0 || $this->flushing) {
+            return;
+        }
+
+        $profiler = $this->rl->profiler();
+        $profiler?->begin('DrawList::flush', 'draw');
+        $this->flushing = true;
+
+        try {
+            if ($this->native) {
+                $calls = $this->ffi->PhpanimDrawBatch($this->commands, $this->count, $this->text);
+                $profiler?->countCalls($calls);
+            } else {
+                $this->replay();
+            }
+        } finally {
+            $this->clear();
+            $this->flushing = false;
+            $profiler?->end();
+        }
+    }
+
+    /**
+     * Empties the list without executing anything.
+     */
+    public function clear(): void
+    {
+        $this->count = 0;
+        $this->textUsed = 0;
+        $this->owners = [];
+        $this->generation++;
+    }
+
+    private function push(int $op, int $color): CData
+    {
+        if ($this->count === $this->capacity) {
+            $capacity = $this->capacity * 2;
+            $commands = $this->ffi->new("PhpanimDrawCommand[{$capacity}]");
+            FFI::memcpy($commands, $this->commands, FFI::sizeof($this->commands));
+
+            $this->commands = $commands;
+            $this->capacity = $capacity;
+        }
+
+        $command = $this->commands[$this->count++];
+        $command->op = $op;
+        $command->color = $color;
+
+        return $command;
+    }
+
+    /**
+     * Copies the text into the text buffer and pushes a command pointing at it.
+     */
+    private function pushText(int $op, string $text, int $color): CData
+    {
+        $length = strlen($text);
+        $this->reserveText($length + 1);
+
+        $command = $this->push($op, $color);
+        $command->count = $this->textUsed;
+
+        if ($length > 0) {
+            FFI::memcpy(FFI::addr($this->text[$this->textUsed]), $text, $length);
+        }
+
+        $this->text[$this->textUsed + $length] = "\0";
+        $this->textUsed += $length + 1;
+
+        return $command;
+    }
+
+    private function reserveText(int $length): void
+    {
+        if ($this->textUsed + $length <= $this->textCapacity) {
+            return;
+        }
+
+        $capacity = max($this->textCapacity * 2, $this->textUsed + $length);
+        $text = $this->ffi->new("char[{$capacity}]");
+        FFI::memcpy($text, $this->text, $this->textUsed);
+
+        $this->text = $text;
+        $this->textCapacity = $capacity;
+    }
+
+    /**
+     * Executes the commands through Raylib, used when the shim is not built.
+     */
+    private function replay(): void
+    {
+        $rl = $this->rl;
+
+        for ($i = 0; $i < $this->count; $i++) {
+            $command = $this->commands[$i];
+            $args = $command->args;
+            $color = $rl->color($command->color);
+
+            match ($command->op) {
+                self::LINE => $rl->DrawLine((int) $args[0], (int) $args[1], (int) $args[2], (int) $args[3], $color),
+                self::LINE_EX => $rl->DrawLineEx(
+                    $this->vector($args[0], $args[1]),
+                    $this->vector($args[2], $args[3]),
+                    $args[4],
+                    $color,
+                ),
+                self::RECTANGLE => $rl->DrawRectangle((int) $args[0], (int) $args[1], (int) $args[2], (int) $args[3], $color),
+                self::CIRCLE => $rl->DrawCircle((int) $args[0], (int) $args[1], $args[2], $color),
+                self::TRIANGLE => $rl->DrawTriangle(
+                    $this->vector($args[0], $args[1]),
+                    $this->vector($args[2], $args[3]),
+                    $this->vector($args[4], $args[5]),
+                    $color,
+                ),
+                self::TEXT => $rl->DrawText(
+                    FFI::string(FFI::addr($this->text[$command->count])),
+                    (int) $args[0],
+                    (int) $args[1],
+                    (int) $args[2],
+                    $color,
+                ),
+                self::SPLINE_LINEAR => $rl->DrawSplineLinear($command->points, $command->count, $args[0], $color),
+                self::SPLINE_CATMULL_ROM => $rl->DrawSplineCatmullRom($command->points, $command->count, $args[0], $color),
+                self::TEXT_EX => $rl->DrawTextEx(
+                    $rl->ffi->cast('Font *', $command->points)[0],
+                    FFI::string(FFI::addr($this->text[$command->count])),
+                    $this->vector($args[0], $args[1]),
+                    $args[2],
+                    $args[3],
+                    $color,
+                ),
+                self::POINTS => $this->replayPoints($command),
+                default => null,
+            };
+        }
+    }
+
+    private function replayPoints(CData $command): void
+    {
+        $rl = $this->rl;
+        $points = $this->ffi->cast('PhpanimPoints *', $command->points)[0];
+        [$size, $originX, $originY, $unitSize] = [$command->args[0], $command->args[1], $command->args[2], $command->args[3]];
+        $half = $size / 2;
+
+        for ($i = 0; $i < $command->count; $i++) {
+            $rl->DrawRectangle(
+                (int) ($originX + $points->x[$i] * $unitSize - $half),
+                (int) ($originY - $points->y[$i] * $unitSize - $half),
+                (int) $size,
+                (int) $size,
+                $rl->color($points->colors[$i]),
+            );
+        }
+    }
+
+    private function vector(float $x, float $y): CData
+    {
+        return $this->rl->struct('Vector2', ['x' => $x, 'y' => $y]);
+    }
+}
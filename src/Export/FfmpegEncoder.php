@@ -0,0 +1,152 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Export;
+
+/**
+ * Streams raw RGBA frames into an ffmpeg child process over its stdin pipe.
+ */
+final class FfmpegEncoder
+{
+    /** @var resource|null */
+    private $process = null;
+
+    /** @var resource|null */
+    private $stdin = null;
+
+    private int $frameSize;
+
+    public function __construct(
+        private string $binary,
+        private string $output,
+        private int $width,
+        private int $height,
+        private int $fps,
+        private string $codec = 'libx264',
+    ) {
+        $this->frameSize = $width * $height * 4;
+    }
+
+    public function open(): void
+    {
+        $command = [
+            $this->binary,
+            '-y',
+            '-loglevel', 'error',
+            '-f', 'rawvideo',
+            '-pixel_format', 'rgba',
+            '-video_size', "{$this->width}x{$this->height}",
+            '-framerate', (string) $this->fps,
+            '-i', '-',
+            // Render textures are stored bottom-up, let ffmpeg flip them.
+            '-vf', 'vflip',
+            '-c:v', $this->codec,
+            '-pix_fmt', 'yuv420p',
+            $this->output,
+        ];
+
+        $process = proc_open($command, [0 => ['pipe', 'r']], $pipes);
+
+        if (!is_resource($process)) {
+            throw new \RuntimeException("Unable to start ffmpeg using '{$this->binary}'.");
+        }
+
+        $this->process = $process;
+        $this->stdin = $pipes[0];
+    }
+
+    public function write(string $pixels): void
+    {
+        if ($this->stdin === null) {
+            throw new \RuntimeException('The encoder has not been opened.');
+        }
+
+        if (strlen($pixels) !== $this->frameSize) {
+            throw new \RuntimeException(sprintf(
+                'Expected a frame of %d bytes, got %d.',
+                $this->frameSize,
+                strlen($pixels),
+            ));
+        }
+
+        $offset = 0;
+        while ($offset < $this->frameSize) {
+            $written = fwrite($this->stdin, $offset === 0 ? $pixels : substr($pixels, $offset));
+
+            if ($written === false || $written === 0) {
+                throw new \RuntimeException('ffmpeg stopped accepting frames.');
+            }
+
+            $offset += $written;
+        }
+    }
+
+    /**
+     * Joins segments that were encoded with the same settings into one file
+     * without re-encoding them.
+     *
+     * @param string[] $segments
+     */
+    public static function concat(string $binary, array $segments, string $output): void
+    {
+        $list = tempnam(sys_get_temp_dir(), 'phpanim-concat-');
+
+        file_put_contents($list, implode('', array_map(
+            static fn(string $segment) => "file '" . str_replace("'", "'\\''", $segment) . "'\n",
+            $segments,
+        )));
+
+        $process = proc_open(
+            [$binary, '-y', '-loglevel', 'error', '-f', 'concat', '-safe', '0', '-i', $list, '-c', 'copy', $output],
+            [],
+            $pipes,
+        );
+
+        $status = is_resource($process) ? proc_close($process) : -1;
+        unlink($list);
+
+        if ($status !== 0) {
+            throw new \RuntimeException("ffmpeg failed to concatenate segments with status {$status}.");
+        }
+    }
+
+    /**
+     * Output of `ffmpeg -version`, which names the build and its libraries.
+     */
+    public static function version(string $binary): string
+    {
+        $process = proc_open([$binary, '-version'], [1 => ['pipe', 'w'], 2 => ['pipe', 'w']], $pipes);
+
+        if (!is_resource($process)) {
+            throw new \RuntimeException("Unable to start ffmpeg using '{$binary}'.");
+        }
+
+        $version = (string) stream_get_contents($pipes[1]);
+        fclose($pipes[1]);
+        fclose($pipes[2]);
+
+        if (proc_close($process) !== 0) {
+            throw new \RuntimeException("Unable to read the version of ffmpeg using '{$binary}'.");
+        }
+
+        return $version;
+    }
+
+    public function close(): void
+    {
+        if ($this->process === null) {
+            return;
+        }
+
+        fclose($this->stdin);
+        $status = proc_close($this->process);
+
+        $this->stdin = null;
+        $this->process = null;
+
+        if ($status !== 0) {
+            throw new \RuntimeException("ffmpeg exited with status {$status}.");
+        }
+    }
+}
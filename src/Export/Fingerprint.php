@@ -0,0 +1,132 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Export;
+
+use Aashan\Phpanim\Raylib;
+use Closure;
+use FFI\CData;
+use ReflectionClass;
+use ReflectionFunction;
+use UnitEnum;
+
+/**
+ * Hashes values together with the source code they depend on.
+ *
+ * Objects are hashed by their properties and the files declaring their
+ * class, parents and traits, closures by their static variables and the
+ * file they were written in. Editing a scene's class or the plugin file
+ * constructing it therefore changes its fingerprint, and so does passing
+ * it different parameters.
+ *
+ * Raylib handles and FFI data are environment rather than content and only
+ * contribute their type.
+ */
+final class Fingerprint
+{
+    private \HashContext $context;
+
+    /** @var array<int, int> Order objects were first hashed in, by id */
+    private array $seen = [];
+
+    /** @var array<string, true> */
+    private array $files = [];
+
+    public function __construct()
+    {
+        $this->context = hash_init('xxh128');
+    }
+
+    public function add(mixed $value): self
+    {
+        match (true) {
+            $value === null, is_scalar($value) => hash_update($this->context, get_debug_type($value) . ':' . var_export($value, true) . ';'),
+            is_array($value) => $this->addArray($value),
+            is_object($value) => $this->addObject($value),
+            default => hash_update($this->context, get_debug_type($value) . ';'),
+        };
+
+        return $this;
+    }
+
+    public function addFile(string $path): self
+    {
+        if (isset($this->files[$path])) {
+            return $this;
+        }
+
+        $this->files[$path] = true;
+        hash_update($this->context, 'file:' . $path . ':');
+        hash_update_file($this->context, $path);
+
+        return $this;
+    }
+
+    /**
+     * Adds the files declaring a class, its parents and their traits.
+     */
+    public function addClass(string $class): self
+    {
+        for ($reflection = new ReflectionClass($class); $reflection !== false; $reflection = $reflection->getParentClass()) {
+            if ($reflection->getFileName() !== false) {
+                $this->addFile($reflection->getFileName());
+            }
+
+            foreach ($reflection->getTraitNames() as $trait) {
+                $this->addClass($trait);
+            }
+        }
+
+        return $this;
+    }
+
+    public function hash(): string
+    {
+        return hash_final(hash_copy($this->context));
+    }
+
+    private function addArray(array $value): void
+    {
+        hash_update($this->context, 'array:' . count($value) . '[');
+
+        foreach ($value as $key => $item) {
+            $this->add($key);
+            $this->add($item);
+        }
+
+        hash_update($this->context, ']');
+    }
+
+    private function addObject(object $value): void
+    {
+        $id = spl_object_id($value);
+
+        // Object ids differ between runs, repeated objects are referred to by order instead
+        if (isset($this->seen[$id])) {
+            hash_update($this->context, "ref:{$this->seen[$id]};");
+            return;
+        }
+
+        $this->seen[$id] = count($this->seen);
+        hash_update($this->context, 'object:' . $value::class . '{');
+
+        if ($value instanceof Closure) {
+            $function = new ReflectionFunction($value);
+
+            if ($function->getFileName() !== false) {
+                $this->addFile($function->getFileName());
+                $this->add([$function->getStartLine(), $function->getEndLine()]);
+            }
+
+            $this->add($function->getStaticVariables());
+        } elseif ($value instanceof UnitEnum) {
+            $this->add($value->name);
+        } elseif (!$value instanceof Raylib && !$value instanceof CData) {
+            $this->addClass($value::class);
+            $this->addArray((array) $value);
+        }
+
+        hash_update($this->context, '}');
+    }
+}
@@ -0,0 +1,85 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Export;
+
+use Aashan\Phpanim\Raylib;
+use FFI;
+use FFI\CData;
+
+/**
+ * Renders frames into a pair of offscreen render textures and reads them back.
+ *
+ * Frames alternate between the two textures, and the pixels of a frame are
+ * only read once the next frame has been submitted, so the readback of frame
+ * N-1 overlaps with the GPU work for frame N and with ffmpeg encoding it.
+ */
+final class FrameCapture
+{
+    /** @var CData[] */
+    private array $targets = [];
+
+    private int $frame = 0;
+
+    private ?int $pending = null;
+
+    public function __construct(
+        private Raylib $rl,
+        private int $width,
+        private int $height,
+    ) {
+        for ($i = 0; $i < 2; $i++) {
+            $this->targets[] = $rl->LoadRenderTexture($width, $height);
+        }
+    }
+
+    public function begin(): void
+    {
+        $this->rl->pushRenderTarget($this->targets[$this->frame & 1]);
+    }
+
+    /**
+     * Finishes the current frame and returns the pixels of the previously
+     * captured frame, if there is one waiting.
+     */
+    public function end(bool $capture = true): ?string
+    {
+        $this->rl->popRenderTarget();
+
+        $previous = $this->pending;
+        $this->pending = $capture ? $this->frame & 1 : null;
+        $this->frame++;
+
+        return $previous === null ? null : $this->read($previous);
+    }
+
+    /**
+     * Returns the pixels of the last captured frame that has not been read yet.
+     */
+    public function flush(): ?string
+    {
+        $previous = $this->pending;
+        $this->pending = null;
+
+        return $previous === null ? null : $this->read($previous);
+    }
+
+    public function release(): void
+    {
+        foreach ($this->targets as $target) {
+            $this->rl->UnloadRenderTexture($target);
+        }
+
+        $this->targets = [];
+    }
+
+    private function read(int $index): string
+    {
+        $image = $this->rl->LoadImageFromTexture($this->targets[$index]->texture);
+        $pixels = FFI::string($image->data, $this->width * $this->height * 4);
+        $this->rl->UnloadImage($image);
+
+        return $pixels;
+    }
+}
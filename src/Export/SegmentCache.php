@@ -0,0 +1,113 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Export;
+
+/**
+ * On-disk cache of encoded video segments.
+ *
+ * Every entry is a segment file plus a small JSON file describing it, both
+ * named after the entry's key. Reading an entry touches it, and once the
+ * segments take more than the size cap the least recently used ones are
+ * deleted first.
+ */
+final class SegmentCache
+{
+    public function __construct(
+        private string $directory,
+        private int $maxBytes,
+        private string $extension = 'mp4',
+    ) {
+        if (!is_dir($directory) && !@mkdir($directory, 0777, true) && !is_dir($directory)) {
+            throw new \RuntimeException("Unable to create the cache directory {$directory}.");
+        }
+    }
+
+    /**
+     * @return array{path: string, frames: int, complete: bool}|null
+     */
+    public function get(string $key): ?array
+    {
+        $path = $this->path($key);
+        $meta = @file_get_contents($path . '.json');
+
+        if ($meta === false || !is_file($path)) {
+            return null;
+        }
+
+        $entry = json_decode($meta, true);
+        if (!is_array($entry)) {
+            return null;
+        }
+
+        touch($path);
+
+        return ['path' => $path] + $entry;
+    }
+
+    /**
+     * Path a new segment for $key should be encoded into before put() is called.
+     */
+    public function reserve(string $key): string
+    {
+        return $this->path($key) . '.' . getmypid() . '.tmp.' . $this->extension;
+    }
+
+    /**
+     * Moves an encoded segment into the cache.
+     *
+     * $complete tells whether the segment ended because its scene did, rather
+     * than because the export stopped, i.e. whether it covers the whole scene.
+     */
+    public function put(string $key, string $segment, int $frames, bool $complete): string
+    {
+        $path = $this->path($key);
+
+        if (!rename($segment, $path)) {
+            throw new \RuntimeException("Unable to move the segment {$segment} into the cache.");
+        }
+
+        file_put_contents($path . '.json', json_encode(['frames' => $frames, 'complete' => $complete]));
+
+        return $path;
+    }
+
+    /**
+     * Deletes the least recently used segments until the cache fits its cap.
+     */
+    public function evict(): void
+    {
+        clearstatcache();
+
+        $segments = [];
+        $size = 0;
+
+        foreach (glob($this->directory . '/*.' . $this->extension) ?: [] as $path) {
+            if (str_contains(basename($path), '.tmp.')) {
+                continue;
+            }
+
+            $stat = stat($path);
+            $segments[$path] = $stat['mtime'];
+            $size += $stat['size'];
+        }
+
+        asort($segments);
+
+        foreach (array_keys($segments) as $path) {
+            if ($size <= $this->maxBytes) {
+                break;
+            }
+
+            $size -= filesize($path);
+            @unlink($path);
+            @unlink($path . '.json');
+        }
+    }
+
+    private function path(string $key): string
+    {
+        return "{$this->directory}/{$key}.{$this->extension}";
+    }
+}
@@ -0,0 +1,1687 @@
+<?php
+
+// This file is generated by bin/generate-binding.php from lib/raylib.h, do not edit it by hand.
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Generated;
+
+use FFI\CData;
+
+/**
+ * Typed methods for every function declared in lib/raylib.h.
+ *
+ * @property-read \FFI|\Aashan\Phpanim\Profiling\CountingFfi $ffi
+ */
+trait RaylibFunctions
+{
+    // Names of the methods that flush the draw list before calling FFI
+    public const FLUSHES_DRAW_LIST = '/^(Draw|ClearBackground$|Begin|End|SwapScreenBuffer$|TakeScreenshot$|LoadImageFrom(Texture|Screen)$|Unload(RenderTexture|Texture|Font|Shader)$|UpdateTexture|SetShaderValue|SetTextureFilter$)/';
+
+    /** Initialize window and OpenGL context */
+    public function InitWindow(int|float $width, int|float $height, CData|string|null $title): void
+    {
+        $this->ffi->InitWindow((int) $width, (int) $height, $title);
+    }
+
+    /** Close window and unload OpenGL context */
+    public function CloseWindow(): void
+    {
+        $this->ffi->CloseWindow();
+    }
+
+    /** Check if application should close (KEY_ESCAPE pressed or windows close icon clicked) */
+    public function WindowShouldClose(): bool
+    {
+        return $this->ffi->WindowShouldClose();
+    }
+
+    /** Check if window has been initialized successfully */
+    public function IsWindowReady(): bool
+    {
+        return $this->ffi->IsWindowReady();
+    }
+
+    /** Check if window is currently fullscreen */
+    public function IsWindowFullscreen(): bool
+    {
+        return $this->ffi->IsWindowFullscreen();
+    }
+
+    /** Check if window is currently hidden */
+    public function IsWindowHidden(): bool
+    {
+        return $this->ffi->IsWindowHidden();
+    }
+
+    /** Check if window is currently minimized */
+    public function IsWindowMinimized(): bool
+    {
+        return $this->ffi->IsWindowMinimized();
+    }
+
+    /** Check if window is currently maximized */
+    public function IsWindowMaximized(): bool
+    {
+        return $this->ffi->IsWindowMaximized();
+    }
+
+    /** Check if window is currently focused */
+    public function IsWindowFocused(): bool
+    {
+        return $this->ffi->IsWindowFocused();
+    }
+
+    /** Check if window has been resized last frame */
+    public function IsWindowResized(): bool
+    {
+        return $this->ffi->IsWindowResized();
+    }
+
+    /** Check if one specific window flag is enabled */
+    public function IsWindowState(int|float $flag): bool
+    {
+        return $this->ffi->IsWindowState((int) $flag);
+    }
+
+    /** Set window configuration state using flags */
+    public function SetWindowState(int|float $flags): void
+    {
+        $this->ffi->SetWindowState((int) $flags);
+    }
+
+    /** Clear window configuration state flags */
+    public function ClearWindowState(int|float $flags): void
+    {
+        $this->ffi->ClearWindowState((int) $flags);
+    }
+
+    /** Toggle window state: fullscreen/windowed, resizes monitor to match window resolution */
+    public function ToggleFullscreen(): void
+    {
+        $this->ffi->ToggleFullscreen();
+    }
+
+    /** Toggle window state: borderless windowed, resizes window to match monitor resolution */
+    public function ToggleBorderlessWindowed(): void
+    {
+        $this->ffi->ToggleBorderlessWindowed();
+    }
+
+    /** Set window state: maximized, if resizable */
+    public function MaximizeWindow(): void
+    {
+        $this->ffi->MaximizeWindow();
+    }
+
+    /** Set window state: minimized, if resizable */
+    public function MinimizeWindow(): void
+    {
+        $this->ffi->MinimizeWindow();
+    }
+
+    /** Set window state: not minimized/maximized */
+    public function RestoreWindow(): void
+    {
+        $this->ffi->RestoreWindow();
+    }
+
+    /** Set icon for window (single image, RGBA 32bit) */
+    public function SetWindowIcon(CData $image): void
+    {
+        $this->ffi->SetWindowIcon($image);
+    }
+
+    /** Set icon for window (multiple images, RGBA 32bit) */
+    public function SetWindowIcons(?CData $images, int|float $count): void
+    {
+        $this->ffi->SetWindowIcons($images, (int) $count);
+    }
+
+    /** Set title for window */
+    public function SetWindowTitle(CData|string|null $title): void
+    {
+        $this->ffi->SetWindowTitle($title);
+    }
+
+    /** Set window position on screen */
+    public function SetWindowPosition(int|float $x, int|float $y): void
+    {
+        $this->ffi->SetWindowPosition((int) $x, (int) $y);
+    }
+
+    /** Set monitor for the current window */
+    public function SetWindowMonitor(int|float $monitor): void
+    {
+        $this->ffi->SetWindowMonitor((int) $monitor);
+    }
+
+    /** Set window minimum dimensions (for FLAG_WINDOW_RESIZABLE) */
+    public function SetWindowMinSize(int|float $width, int|float $height): void
+    {
+        $this->ffi->SetWindowMinSize((int) $width, (int) $height);
+    }
+
+    /** Set window maximum dimensions (for FLAG_WINDOW_RESIZABLE) */
+    public function SetWindowMaxSize(int|float $width, int|float $height): void
+    {
+        $this->ffi->SetWindowMaxSize((int) $width, (int) $height);
+    }
+
+    /** Set window dimensions */
+    public function SetWindowSize(int|float $width, int|float $height): void
+    {
+        $this->ffi->SetWindowSize((int) $width, (int) $height);
+    }
+
+    /** Set window opacity [0.0f..1.0f] */
+    public function SetWindowOpacity(float $opacity): void
+    {
+        $this->ffi->SetWindowOpacity($opacity);
+    }
+
+    /** Set window focused */
+    public function SetWindowFocused(): void
+    {
+        $this->ffi->SetWindowFocused();
+    }
+
+    /** Get native window handle */
+    public function GetWindowHandle(): ?CData
+    {
+        return $this->ffi->GetWindowHandle();
+    }
+
+    /** Get current screen width */
+    public function GetScreenWidth(): int
+    {
+        return $this->ffi->GetScreenWidth();
+    }
+
+    /** Get current screen height */
+    public function GetScreenHeight(): int
+    {
+        return $this->ffi->GetScreenHeight();
+    }
+
+    /** Get current render width (it considers HiDPI) */
+    public function GetRenderWidth(): int
+    {
+        return $this->ffi->GetRenderWidth();
+    }
+
+    /** Get current render height (it considers HiDPI) */
+    public function GetRenderHeight(): int
+    {
+        return $this->ffi->GetRenderHeight();
+    }
+
+    /** Get number of connected monitors */
+    public function GetMonitorCount(): int
+    {
+        return $this->ffi->GetMonitorCount();
+    }
+
+    /** Get current monitor where window is placed */
+    public function GetCurrentMonitor(): int
+    {
+        return $this->ffi->GetCurrentMonitor();
+    }
+
+    /** Get specified monitor position */
+    public function GetMonitorPosition(int|float $monitor): CData
+    {
+        return $this->ffi->GetMonitorPosition((int) $monitor);
+    }
+
+    /** Get specified monitor width (current video mode used by monitor) */
+    public function GetMonitorWidth(int|float $monitor): int
+    {
+        return $this->ffi->GetMonitorWidth((int) $monitor);
+    }
+
+    /** Get specified monitor height (current video mode used by monitor) */
+    public function GetMonitorHeight(int|float $monitor): int
+    {
+        return $this->ffi->GetMonitorHeight((int) $monitor);
+    }
+
+    /** Get specified monitor physical width in millimetres */
+    public function GetMonitorPhysicalWidth(int|float $monitor): int
+    {
+        return $this->ffi->GetMonitorPhysicalWidth((int) $monitor);
+    }
+
+    /** Get specified monitor physical height in millimetres */
+    public function GetMonitorPhysicalHeight(int|float $monitor): int
+    {
+        return $this->ffi->GetMonitorPhysicalHeight((int) $monitor);
+    }
+
+    /** Get specified monitor refresh rate */
+    public function GetMonitorRefreshRate(int|float $monitor): int
+    {
+        return $this->ffi->GetMonitorRefreshRate((int) $monitor);
+    }
+
+    /** Get window position XY on monitor */
+    public function GetWindowPosition(): CData
+    {
+        return $this->ffi->GetWindowPosition();
+    }
+
+    /** Get window scale DPI factor */
+    public function GetWindowScaleDPI(): CData
+    {
+        return $this->ffi->GetWindowScaleDPI();
+    }
+
+    /** Get the human-readable, UTF-8 encoded name of the specified monitor */
+    public function GetMonitorName(int|float $monitor): ?string
+    {
+        return $this->ffi->GetMonitorName((int) $monitor);
+    }
+
+    /** Set clipboard text content */
+    public function SetClipboardText(CData|string|null $text): void
+    {
+        $this->ffi->SetClipboardText($text);
+    }
+
+    /** Get clipboard text content */
+    public function GetClipboardText(): ?string
+    {
+        return $this->ffi->GetClipboardText();
+    }
+
+    /** Get clipboard image */
+    public function GetClipboardImage(): CData
+    {
+        return $this->ffi->GetClipboardImage();
+    }
+
+    /** Enable waiting for events on EndDrawing(), no automatic event polling */
+    public function EnableEventWaiting(): void
+    {
+        $this->ffi->EnableEventWaiting();
+    }
+
+    /** Disable waiting for events on EndDrawing(), automatic events polling */
+    public function DisableEventWaiting(): void
+    {
+        $this->ffi->DisableEventWaiting();
+    }
+
+    /** Shows cursor */
+    public function ShowCursor(): void
+    {
+        $this->ffi->ShowCursor();
+    }
+
+    /** Hides cursor */
+    public function HideCursor(): void
+    {
+        $this->ffi->HideCursor();
+    }
+
+    /** Check if cursor is not visible */
+    public function IsCursorHidden(): bool
+    {
+        return $this->ffi->IsCursorHidden();
+    }
+
+    /** Enables cursor (unlock cursor) */
+    public function EnableCursor(): void
+    {
+        $this->ffi->EnableCursor();
+    }
+
+    /** Disables cursor (lock cursor) */
+    public function DisableCursor(): void
+    {
+        $this->ffi->DisableCursor();
+    }
+
+    /** Check if cursor is on the screen */
+    public function IsCursorOnScreen(): bool
+    {
+        return $this->ffi->IsCursorOnScreen();
+    }
+
+    /** Set background color (framebuffer clear color) */
+    public function ClearBackground(CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->ClearBackground($color);
+    }
+
+    /** Setup canvas (framebuffer) to start drawing */
+    public function BeginDrawing(): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->BeginDrawing();
+    }
+
+    /** End canvas drawing and swap buffers (double buffering) */
+    public function EndDrawing(): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->EndDrawing();
+    }
+
+    /** Begin 2D mode with custom camera (2D) */
+    public function BeginMode2D(CData $camera): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->BeginMode2D($camera);
+    }
+
+    /** Ends 2D mode with custom camera */
+    public function EndMode2D(): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->EndMode2D();
+    }
+
+    /** Begin 3D mode with custom camera (3D) */
+    public function BeginMode3D(CData $camera): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->BeginMode3D($camera);
+    }
+
+    /** Ends 3D mode and returns to default 2D orthographic mode */
+    public function EndMode3D(): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->EndMode3D();
+    }
+
+    /** Begin drawing to render texture */
+    public function BeginTextureMode(CData $target): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->BeginTextureMode($target);
+    }
+
+    /** Ends drawing to render texture */
+    public function EndTextureMode(): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->EndTextureMode();
+    }
+
+    /** Begin custom shader drawing */
+    public function BeginShaderMode(CData $shader): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->BeginShaderMode($shader);
+    }
+
+    /** End custom shader drawing (use default shader) */
+    public function EndShaderMode(): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->EndShaderMode();
+    }
+
+    /** Begin blending mode (alpha, additive, multiplied, subtract, custom) */
+    public function BeginBlendMode(int|float $mode): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->BeginBlendMode((int) $mode);
+    }
+
+    /** End blending mode (reset to default: alpha blending) */
+    public function EndBlendMode(): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->EndBlendMode();
+    }
+
+    /** Begin scissor mode (define screen area for following drawing) */
+    public function BeginScissorMode(int|float $x, int|float $y, int|float $width, int|float $height): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->BeginScissorMode((int) $x, (int) $y, (int) $width, (int) $height);
+    }
+
+    /** End scissor mode */
+    public function EndScissorMode(): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->EndScissorMode();
+    }
+
+    /** Begin stereo rendering (requires VR simulator) */
+    public function BeginVrStereoMode(CData $config): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->BeginVrStereoMode($config);
+    }
+
+    /** End stereo rendering (requires VR simulator) */
+    public function EndVrStereoMode(): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->EndVrStereoMode();
+    }
+
+    public function MeasureText(CData|string|null $text, int|float $fontSize): int
+    {
+        return $this->ffi->MeasureText($text, (int) $fontSize);
+    }
+
+    /** Get Color structure from hexadecimal value */
+    public function GetColor(int|float $hexValue): CData
+    {
+        return $this->ffi->GetColor((int) $hexValue);
+    }
+
+    /** Load VR stereo config for VR simulator device parameters */
+    public function LoadVrStereoConfig(CData $device): CData
+    {
+        return $this->ffi->LoadVrStereoConfig($device);
+    }
+
+    /** Unload VR stereo config */
+    public function UnloadVrStereoConfig(CData $config): void
+    {
+        $this->ffi->UnloadVrStereoConfig($config);
+    }
+
+    /** Load shader from files and bind default locations */
+    public function LoadShader(CData|string|null $vsFileName, CData|string|null $fsFileName): CData
+    {
+        return $this->ffi->LoadShader($vsFileName, $fsFileName);
+    }
+
+    /** Load shader from code strings and bind default locations */
+    public function LoadShaderFromMemory(CData|string|null $vsCode, CData|string|null $fsCode): CData
+    {
+        return $this->ffi->LoadShaderFromMemory($vsCode, $fsCode);
+    }
+
+    /** Check if a shader is valid (loaded on GPU) */
+    public function IsShaderValid(CData $shader): bool
+    {
+        return $this->ffi->IsShaderValid($shader);
+    }
+
+    /** Get shader uniform location */
+    public function GetShaderLocation(CData $shader, CData|string|null $uniformName): int
+    {
+        return $this->ffi->GetShaderLocation($shader, $uniformName);
+    }
+
+    /** Get shader attribute location */
+    public function GetShaderLocationAttrib(CData $shader, CData|string|null $attribName): int
+    {
+        return $this->ffi->GetShaderLocationAttrib($shader, $attribName);
+    }
+
+    /** Set shader uniform value */
+    public function SetShaderValue(CData $shader, int|float $locIndex, ?CData $value, int|float $uniformType): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->SetShaderValue($shader, (int) $locIndex, $value, (int) $uniformType);
+    }
+
+    /** Set shader uniform value vector */
+    public function SetShaderValueV(CData $shader, int|float $locIndex, ?CData $value, int|float $uniformType, int|float $count): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->SetShaderValueV($shader, (int) $locIndex, $value, (int) $uniformType, (int) $count);
+    }
+
+    /** Set shader uniform value (matrix 4x4) */
+    public function SetShaderValueMatrix(CData $shader, int|float $locIndex, CData $mat): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->SetShaderValueMatrix($shader, (int) $locIndex, $mat);
+    }
+
+    /** Unload shader from GPU memory (VRAM) */
+    public function UnloadShader(CData $shader): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->UnloadShader($shader);
+    }
+
+    /** Set target FPS (maximum) */
+    public function SetTargetFPS(int|float $fps): void
+    {
+        $this->ffi->SetTargetFPS((int) $fps);
+    }
+
+    /** Get time in seconds for last frame drawn (delta time) */
+    public function GetFrameTime(): float
+    {
+        return $this->ffi->GetFrameTime();
+    }
+
+    /** Get elapsed time in seconds since InitWindow() */
+    public function GetTime(): float
+    {
+        return $this->ffi->GetTime();
+    }
+
+    /** Get current FPS */
+    public function GetFPS(): int
+    {
+        return $this->ffi->GetFPS();
+    }
+
+    /** Swap back buffer with front buffer (screen drawing) */
+    public function SwapScreenBuffer(): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->SwapScreenBuffer();
+    }
+
+    /** Register all input events */
+    public function PollInputEvents(): void
+    {
+        $this->ffi->PollInputEvents();
+    }
+
+    /** Wait for some time (halt program execution) */
+    public function WaitTime(float $seconds): void
+    {
+        $this->ffi->WaitTime($seconds);
+    }
+
+    /** Set the seed for the random number generator */
+    public function SetRandomSeed(int|float $seed): void
+    {
+        $this->ffi->SetRandomSeed((int) $seed);
+    }
+
+    /** Get a random value between min and max (both included) */
+    public function GetRandomValue(int|float $min, int|float $max): int
+    {
+        return $this->ffi->GetRandomValue((int) $min, (int) $max);
+    }
+
+    /** Load random values sequence, no values repeated */
+    public function LoadRandomSequence(int|float $count, int|float $min, int|float $max): ?CData
+    {
+        return $this->ffi->LoadRandomSequence((int) $count, (int) $min, (int) $max);
+    }
+
+    /** Unload random values sequence */
+    public function UnloadRandomSequence(?CData $sequence): void
+    {
+        $this->ffi->UnloadRandomSequence($sequence);
+    }
+
+    /** Takes a screenshot of current screen (filename extension defines format) */
+    public function TakeScreenshot(CData|string|null $fileName): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->TakeScreenshot($fileName);
+    }
+
+    /** Setup init configuration flags (view FLAGS) */
+    public function SetConfigFlags(int|float $flags): void
+    {
+        $this->ffi->SetConfigFlags((int) $flags);
+    }
+
+    /** Open URL with default system browser (if available) */
+    public function OpenURL(CData|string|null $url): void
+    {
+        $this->ffi->OpenURL($url);
+    }
+
+    /** Show trace log messages (LOG_DEBUG, LOG_INFO, LOG_WARNING, LOG_ERROR...) */
+    public function TraceLog(int|float $logLevel, CData|string|null $text, mixed ...$args): void
+    {
+        $this->ffi->TraceLog((int) $logLevel, $text, ...$args);
+    }
+
+    /** Set the current threshold (minimum) log level */
+    public function SetTraceLogLevel(int|float $logLevel): void
+    {
+        $this->ffi->SetTraceLogLevel((int) $logLevel);
+    }
+
+    /** Internal memory allocator */
+    public function MemAlloc(int|float $size): ?CData
+    {
+        return $this->ffi->MemAlloc((int) $size);
+    }
+
+    /** Internal memory reallocator */
+    public function MemRealloc(?CData $ptr, int|float $size): ?CData
+    {
+        return $this->ffi->MemRealloc($ptr, (int) $size);
+    }
+
+    /** Internal memory free */
+    public function MemFree(?CData $ptr): void
+    {
+        $this->ffi->MemFree($ptr);
+    }
+
+    /** Load file data as byte array (read) */
+    public function LoadFileData(CData|string|null $fileName, ?CData $dataSize): ?CData
+    {
+        return $this->ffi->LoadFileData($fileName, $dataSize);
+    }
+
+    /** Unload file data allocated by LoadFileData() */
+    public function UnloadFileData(?CData $data): void
+    {
+        $this->ffi->UnloadFileData($data);
+    }
+
+    /** Save data to file from byte array (write), returns true on success */
+    public function SaveFileData(CData|string|null $fileName, ?CData $data, int|float $dataSize): bool
+    {
+        return $this->ffi->SaveFileData($fileName, $data, (int) $dataSize);
+    }
+
+    /** Export data to code (.h), returns true on success */
+    public function ExportDataAsCode(?CData $data, int|float $dataSize, CData|string|null $fileName): bool
+    {
+        return $this->ffi->ExportDataAsCode($data, (int) $dataSize, $fileName);
+    }
+
+    /** Load text data from file (read), returns a '\0' terminated string */
+    public function LoadFileText(CData|string|null $fileName): ?CData
+    {
+        return $this->ffi->LoadFileText($fileName);
+    }
+
+    /** Unload file text data allocated by LoadFileText() */
+    public function UnloadFileText(CData|string|null $text): void
+    {
+        $this->ffi->UnloadFileText($text);
+    }
+
+    /** Save text data to file (write), string must be '\0' terminated, returns true on success */
+    public function SaveFileText(CData|string|null $fileName, CData|string|null $text): bool
+    {
+        return $this->ffi->SaveFileText($fileName, $text);
+    }
+
+    /** Check if file exists */
+    public function FileExists(CData|string|null $fileName): bool
+    {
+        return $this->ffi->FileExists($fileName);
+    }
+
+    /** Check if a directory path exists */
+    public function DirectoryExists(CData|string|null $dirPath): bool
+    {
+        return $this->ffi->DirectoryExists($dirPath);
+    }
+
+    /** Check file extension (including point: .png, .wav) */
+    public function IsFileExtension(CData|string|null $fileName, CData|string|null $ext): bool
+    {
+        return $this->ffi->IsFileExtension($fileName, $ext);
+    }
+
+    /** Get file length in bytes (NOTE: GetFileSize() conflicts with windows.h) */
+    public function GetFileLength(CData|string|null $fileName): int
+    {
+        return $this->ffi->GetFileLength($fileName);
+    }
+
+    /** Get pointer to extension for a filename string (includes dot: '.png') */
+    public function GetFileExtension(CData|string|null $fileName): ?string
+    {
+        return $this->ffi->GetFileExtension($fileName);
+    }
+
+    /** Get pointer to filename for a path string */
+    public function GetFileName(CData|string|null $filePath): ?string
+    {
+        return $this->ffi->GetFileName($filePath);
+    }
+
+    /** Get filename string without extension (uses static string) */
+    public function GetFileNameWithoutExt(CData|string|null $filePath): ?string
+    {
+        return $this->ffi->GetFileNameWithoutExt($filePath);
+    }
+
+    /** Get full path for a given fileName with path (uses static string) */
+    public function GetDirectoryPath(CData|string|null $filePath): ?string
+    {
+        return $this->ffi->GetDirectoryPath($filePath);
+    }
+
+    /** Get previous directory path for a given path (uses static string) */
+    public function GetPrevDirectoryPath(CData|string|null $dirPath): ?string
+    {
+        return $this->ffi->GetPrevDirectoryPath($dirPath);
+    }
+
+    /** Get current working directory (uses static string) */
+    public function GetWorkingDirectory(): ?string
+    {
+        return $this->ffi->GetWorkingDirectory();
+    }
+
+    /** Get the directory of the running application (uses static string) */
+    public function GetApplicationDirectory(): ?string
+    {
+        return $this->ffi->GetApplicationDirectory();
+    }
+
+    /** Create directories (including full path requested), returns 0 on success */
+    public function MakeDirectory(CData|string|null $dirPath): int
+    {
+        return $this->ffi->MakeDirectory($dirPath);
+    }
+
+    /** Change working directory, return true on success */
+    public function ChangeDirectory(CData|string|null $dir): bool
+    {
+        return $this->ffi->ChangeDirectory($dir);
+    }
+
+    /** Check if a given path is a file or a directory */
+    public function IsPathFile(CData|string|null $path): bool
+    {
+        return $this->ffi->IsPathFile($path);
+    }
+
+    /** Check if fileName is valid for the platform/OS */
+    public function IsFileNameValid(CData|string|null $fileName): bool
+    {
+        return $this->ffi->IsFileNameValid($fileName);
+    }
+
+    /** Load directory filepaths */
+    public function LoadDirectoryFiles(CData|string|null $dirPath): CData
+    {
+        return $this->ffi->LoadDirectoryFiles($dirPath);
+    }
+
+    /** Load directory filepaths with extension filtering and recursive directory scan. Use 'DIR' in the filter string to include directories in the result */
+    public function LoadDirectoryFilesEx(CData|string|null $basePath, CData|string|null $filter, bool $scanSubdirs): CData
+    {
+        return $this->ffi->LoadDirectoryFilesEx($basePath, $filter, $scanSubdirs);
+    }
+
+    /** Unload filepaths */
+    public function UnloadDirectoryFiles(CData $files): void
+    {
+        $this->ffi->UnloadDirectoryFiles($files);
+    }
+
+    /** Check if a file has been dropped into window */
+    public function IsFileDropped(): bool
+    {
+        return $this->ffi->IsFileDropped();
+    }
+
+    /** Load dropped filepaths */
+    public function LoadDroppedFiles(): CData
+    {
+        return $this->ffi->LoadDroppedFiles();
+    }
+
+    /** Unload dropped filepaths */
+    public function UnloadDroppedFiles(CData $files): void
+    {
+        $this->ffi->UnloadDroppedFiles($files);
+    }
+
+    /** Get file modification time (last write time) */
+    public function GetFileModTime(CData|string|null $fileName): int
+    {
+        return $this->ffi->GetFileModTime($fileName);
+    }
+
+    /** Compress data (DEFLATE algorithm), memory must be MemFree() */
+    public function CompressData(?CData $data, int|float $dataSize, ?CData $compDataSize): ?CData
+    {
+        return $this->ffi->CompressData($data, (int) $dataSize, $compDataSize);
+    }
+
+    /** Decompress data (DEFLATE algorithm), memory must be MemFree() */
+    public function DecompressData(?CData $compData, int|float $compDataSize, ?CData $dataSize): ?CData
+    {
+        return $this->ffi->DecompressData($compData, (int) $compDataSize, $dataSize);
+    }
+
+    /** Encode data to Base64 string, memory must be MemFree() */
+    public function EncodeDataBase64(?CData $data, int|float $dataSize, ?CData $outputSize): ?CData
+    {
+        return $this->ffi->EncodeDataBase64($data, (int) $dataSize, $outputSize);
+    }
+
+    /** Decode Base64 string data, memory must be MemFree() */
+    public function DecodeDataBase64(?CData $data, ?CData $outputSize): ?CData
+    {
+        return $this->ffi->DecodeDataBase64($data, $outputSize);
+    }
+
+    /** Compute CRC32 hash code */
+    public function ComputeCRC32(?CData $data, int|float $dataSize): int
+    {
+        return $this->ffi->ComputeCRC32($data, (int) $dataSize);
+    }
+
+    /** Compute MD5 hash code, returns static int[4] (16 bytes) */
+    public function ComputeMD5(?CData $data, int|float $dataSize): ?CData
+    {
+        return $this->ffi->ComputeMD5($data, (int) $dataSize);
+    }
+
+    /** Compute SHA1 hash code, returns static int[5] (20 bytes) */
+    public function ComputeSHA1(?CData $data, int|float $dataSize): ?CData
+    {
+        return $this->ffi->ComputeSHA1($data, (int) $dataSize);
+    }
+
+    /** Check if a key has been pressed once */
+    public function IsKeyPressed(int|float $key): bool
+    {
+        return $this->ffi->IsKeyPressed((int) $key);
+    }
+
+    /** Check if a key has been pressed again */
+    public function IsKeyPressedRepeat(int|float $key): bool
+    {
+        return $this->ffi->IsKeyPressedRepeat((int) $key);
+    }
+
+    /** Check if a key is being pressed */
+    public function IsKeyDown(int|float $key): bool
+    {
+        return $this->ffi->IsKeyDown((int) $key);
+    }
+
+    /** Check if a key has been released once */
+    public function IsKeyReleased(int|float $key): bool
+    {
+        return $this->ffi->IsKeyReleased((int) $key);
+    }
+
+    /** Check if a key is NOT being pressed */
+    public function IsKeyUp(int|float $key): bool
+    {
+        return $this->ffi->IsKeyUp((int) $key);
+    }
+
+    /** Get key pressed (keycode), call it multiple times for keys queued, returns 0 when the queue is empty */
+    public function GetKeyPressed(): int
+    {
+        return $this->ffi->GetKeyPressed();
+    }
+
+    /** Get char pressed (unicode), call it multiple times for chars queued, returns 0 when the queue is empty */
+    public function GetCharPressed(): int
+    {
+        return $this->ffi->GetCharPressed();
+    }
+
+    /** Set a custom key to exit program (default is ESC) */
+    public function SetExitKey(int|float $key): void
+    {
+        $this->ffi->SetExitKey((int) $key);
+    }
+
+    /** Check if a gamepad is available */
+    public function IsGamepadAvailable(int|float $gamepad): bool
+    {
+        return $this->ffi->IsGamepadAvailable((int) $gamepad);
+    }
+
+    /** Get gamepad internal name id */
+    public function GetGamepadName(int|float $gamepad): ?string
+    {
+        return $this->ffi->GetGamepadName((int) $gamepad);
+    }
+
+    /** Check if a gamepad button has been pressed once */
+    public function IsGamepadButtonPressed(int|float $gamepad, int|float $button): bool
+    {
+        return $this->ffi->IsGamepadButtonPressed((int) $gamepad, (int) $button);
+    }
+
+    /** Check if a gamepad button is being pressed */
+    public function IsGamepadButtonDown(int|float $gamepad, int|float $button): bool
+    {
+        return $this->ffi->IsGamepadButtonDown((int) $gamepad, (int) $button);
+    }
+
+    /** Check if a gamepad button has been released once */
+    public function IsGamepadButtonReleased(int|float $gamepad, int|float $button): bool
+    {
+        return $this->ffi->IsGamepadButtonReleased((int) $gamepad, (int) $button);
+    }
+
+    /** Check if a gamepad button is NOT being pressed */
+    public function IsGamepadButtonUp(int|float $gamepad, int|float $button): bool
+    {
+        return $this->ffi->IsGamepadButtonUp((int) $gamepad, (int) $button);
+    }
+
+    /** Get the last gamepad button pressed */
+    public function GetGamepadButtonPressed(): int
+    {
+        return $this->ffi->GetGamepadButtonPressed();
+    }
+
+    /** Get gamepad axis count for a gamepad */
+    public function GetGamepadAxisCount(int|float $gamepad): int
+    {
+        return $this->ffi->GetGamepadAxisCount((int) $gamepad);
+    }
+
+    /** Get axis movement value for a gamepad axis */
+    public function GetGamepadAxisMovement(int|float $gamepad, int|float $axis): float
+    {
+        return $this->ffi->GetGamepadAxisMovement((int) $gamepad, (int) $axis);
+    }
+
+    /** Set internal gamepad mappings (SDL_GameControllerDB) */
+    public function SetGamepadMappings(CData|string|null $mappings): int
+    {
+        return $this->ffi->SetGamepadMappings($mappings);
+    }
+
+    /** Set gamepad vibration for both motors (duration in seconds) */
+    public function SetGamepadVibration(int|float $gamepad, float $leftMotor, float $rightMotor, float $duration): void
+    {
+        $this->ffi->SetGamepadVibration((int) $gamepad, $leftMotor, $rightMotor, $duration);
+    }
+
+    /** Check if a mouse button has been pressed once */
+    public function IsMouseButtonPressed(int|float $button): bool
+    {
+        return $this->ffi->IsMouseButtonPressed((int) $button);
+    }
+
+    /** Check if a mouse button is being pressed */
+    public function IsMouseButtonDown(int|float $button): bool
+    {
+        return $this->ffi->IsMouseButtonDown((int) $button);
+    }
+
+    /** Check if a mouse button has been released once */
+    public function IsMouseButtonReleased(int|float $button): bool
+    {
+        return $this->ffi->IsMouseButtonReleased((int) $button);
+    }
+
+    /** Check if a mouse button is NOT being pressed */
+    public function IsMouseButtonUp(int|float $button): bool
+    {
+        return $this->ffi->IsMouseButtonUp((int) $button);
+    }
+
+    /** Get mouse position X */
+    public function GetMouseX(): int
+    {
+        return $this->ffi->GetMouseX();
+    }
+
+    /** Get mouse position Y */
+    public function GetMouseY(): int
+    {
+        return $this->ffi->GetMouseY();
+    }
+
+    /** Get mouse position XY */
+    public function GetMousePosition(): CData
+    {
+        return $this->ffi->GetMousePosition();
+    }
+
+    /** Get mouse delta between frames */
+    public function GetMouseDelta(): CData
+    {
+        return $this->ffi->GetMouseDelta();
+    }
+
+    /** Set mouse position XY */
+    public function SetMousePosition(int|float $x, int|float $y): void
+    {
+        $this->ffi->SetMousePosition((int) $x, (int) $y);
+    }
+
+    /** Set mouse offset */
+    public function SetMouseOffset(int|float $offsetX, int|float $offsetY): void
+    {
+        $this->ffi->SetMouseOffset((int) $offsetX, (int) $offsetY);
+    }
+
+    /** Set mouse scaling */
+    public function SetMouseScale(float $scaleX, float $scaleY): void
+    {
+        $this->ffi->SetMouseScale($scaleX, $scaleY);
+    }
+
+    /** Get mouse wheel movement for X or Y, whichever is larger */
+    public function GetMouseWheelMove(): float
+    {
+        return $this->ffi->GetMouseWheelMove();
+    }
+
+    /** Get mouse wheel movement for both X and Y */
+    public function GetMouseWheelMoveV(): CData
+    {
+        return $this->ffi->GetMouseWheelMoveV();
+    }
+
+    /** Set mouse cursor */
+    public function SetMouseCursor(int|float $cursor): void
+    {
+        $this->ffi->SetMouseCursor((int) $cursor);
+    }
+
+    /** Get touch position X for touch point 0 (relative to screen size) */
+    public function GetTouchX(): int
+    {
+        return $this->ffi->GetTouchX();
+    }
+
+    /** Get touch position Y for touch point 0 (relative to screen size) */
+    public function GetTouchY(): int
+    {
+        return $this->ffi->GetTouchY();
+    }
+
+    /** Get touch position XY for a touch point index (relative to screen size) */
+    public function GetTouchPosition(int|float $index): CData
+    {
+        return $this->ffi->GetTouchPosition((int) $index);
+    }
+
+    /** Get touch point identifier for given index */
+    public function GetTouchPointId(int|float $index): int
+    {
+        return $this->ffi->GetTouchPointId((int) $index);
+    }
+
+    /** Get number of touch points */
+    public function GetTouchPointCount(): int
+    {
+        return $this->ffi->GetTouchPointCount();
+    }
+
+    /** Enable a set of gestures using flags */
+    public function SetGesturesEnabled(int|float $flags): void
+    {
+        $this->ffi->SetGesturesEnabled((int) $flags);
+    }
+
+    /** Check if a gesture have been detected */
+    public function IsGestureDetected(int|float $gesture): bool
+    {
+        return $this->ffi->IsGestureDetected((int) $gesture);
+    }
+
+    /** Get latest detected gesture */
+    public function GetGestureDetected(): int
+    {
+        return $this->ffi->GetGestureDetected();
+    }
+
+    /** Get gesture hold time in seconds */
+    public function GetGestureHoldDuration(): float
+    {
+        return $this->ffi->GetGestureHoldDuration();
+    }
+
+    /** Get gesture drag vector */
+    public function GetGestureDragVector(): CData
+    {
+        return $this->ffi->GetGestureDragVector();
+    }
+
+    /** Get gesture drag angle */
+    public function GetGestureDragAngle(): float
+    {
+        return $this->ffi->GetGestureDragAngle();
+    }
+
+    /** Get gesture pinch delta */
+    public function GetGesturePinchVector(): CData
+    {
+        return $this->ffi->GetGesturePinchVector();
+    }
+
+    /** Get gesture pinch angle */
+    public function GetGesturePinchAngle(): float
+    {
+        return $this->ffi->GetGesturePinchAngle();
+    }
+
+    /** Draw a pixel using geometry [Can be slow, use with care] */
+    public function DrawPixel(int|float $posX, int|float $posY, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawPixel((int) $posX, (int) $posY, $color);
+    }
+
+    /** Draw a pixel using geometry (Vector version) [Can be slow, use with care] */
+    public function DrawPixelV(CData $position, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawPixelV($position, $color);
+    }
+
+    /** Draw text (using default font) */
+    public function DrawText(CData|string|null $text, int|float $posX, int|float $posY, int|float $fontSize, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawText($text, (int) $posX, (int) $posY, (int) $fontSize, $color);
+    }
+
+    /** Draw a line */
+    public function DrawLine(int|float $startPosX, int|float $startPosY, int|float $endPosX, int|float $endPosY, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawLine((int) $startPosX, (int) $startPosY, (int) $endPosX, (int) $endPosY, $color);
+    }
+
+    /** Draw a line (using gl lines) */
+    public function DrawLineV(CData $startPos, CData $endPos, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawLineV($startPos, $endPos, $color);
+    }
+
+    /** Draw a line (using triangles/quads) */
+    public function DrawLineEx(CData $startPos, CData $endPos, float $thick, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawLineEx($startPos, $endPos, $thick, $color);
+    }
+
+    /** Draw lines sequence (using gl lines) */
+    public function DrawLineStrip(?CData $points, int|float $pointCount, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawLineStrip($points, (int) $pointCount, $color);
+    }
+
+    /** Draw line segment cubic-bezier in-out interpolation */
+    public function DrawLineBezier(CData $startPos, CData $endPos, float $thick, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawLineBezier($startPos, $endPos, $thick, $color);
+    }
+
+    /** Draw a color-filled circle */
+    public function DrawCircle(int|float $centerX, int|float $centerY, float $radius, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawCircle((int) $centerX, (int) $centerY, $radius, $color);
+    }
+
+    /** Draw a piece of a circle */
+    public function DrawCircleSector(CData $center, float $radius, float $startAngle, float $endAngle, int|float $segments, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawCircleSector($center, $radius, $startAngle, $endAngle, (int) $segments, $color);
+    }
+
+    /** Draw circle sector outline */
+    public function DrawCircleSectorLines(CData $center, float $radius, float $startAngle, float $endAngle, int|float $segments, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawCircleSectorLines($center, $radius, $startAngle, $endAngle, (int) $segments, $color);
+    }
+
+    /** Draw a gradient-filled circle */
+    public function DrawCircleGradient(int|float $centerX, int|float $centerY, float $radius, CData $inner, CData $outer): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawCircleGradient((int) $centerX, (int) $centerY, $radius, $inner, $outer);
+    }
+
+    /** Draw a color-filled circle (Vector version) */
+    public function DrawCircleV(CData $center, float $radius, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawCircleV($center, $radius, $color);
+    }
+
+    /** Draw circle outline */
+    public function DrawCircleLines(int|float $centerX, int|float $centerY, float $radius, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawCircleLines((int) $centerX, (int) $centerY, $radius, $color);
+    }
+
+    /** Draw circle outline (Vector version) */
+    public function DrawCircleLinesV(CData $center, float $radius, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawCircleLinesV($center, $radius, $color);
+    }
+
+    /** Draw ellipse */
+    public function DrawEllipse(int|float $centerX, int|float $centerY, float $radiusH, float $radiusV, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawEllipse((int) $centerX, (int) $centerY, $radiusH, $radiusV, $color);
+    }
+
+    /** Draw ellipse outline */
+    public function DrawEllipseLines(int|float $centerX, int|float $centerY, float $radiusH, float $radiusV, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawEllipseLines((int) $centerX, (int) $centerY, $radiusH, $radiusV, $color);
+    }
+
+    /** Draw ring */
+    public function DrawRing(CData $center, float $innerRadius, float $outerRadius, float $startAngle, float $endAngle, int|float $segments, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawRing($center, $innerRadius, $outerRadius, $startAngle, $endAngle, (int) $segments, $color);
+    }
+
+    /** Draw ring outline */
+    public function DrawRingLines(CData $center, float $innerRadius, float $outerRadius, float $startAngle, float $endAngle, int|float $segments, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawRingLines($center, $innerRadius, $outerRadius, $startAngle, $endAngle, (int) $segments, $color);
+    }
+
+    /** Draw a color-filled rectangle */
+    public function DrawRectangle(int|float $posX, int|float $posY, int|float $width, int|float $height, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawRectangle((int) $posX, (int) $posY, (int) $width, (int) $height, $color);
+    }
+
+    /** Draw a color-filled rectangle (Vector version) */
+    public function DrawRectangleV(CData $position, CData $size, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawRectangleV($position, $size, $color);
+    }
+
+    /** Draw a color-filled rectangle */
+    public function DrawRectangleRec(CData $rec, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawRectangleRec($rec, $color);
+    }
+
+    /** Draw a color-filled rectangle with pro parameters */
+    public function DrawRectanglePro(CData $rec, CData $origin, float $rotation, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawRectanglePro($rec, $origin, $rotation, $color);
+    }
+
+    /** Draw a vertical-gradient-filled rectangle */
+    public function DrawRectangleGradientV(int|float $posX, int|float $posY, int|float $width, int|float $height, CData $top, CData $bottom): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawRectangleGradientV((int) $posX, (int) $posY, (int) $width, (int) $height, $top, $bottom);
+    }
+
+    /** Draw a horizontal-gradient-filled rectangle */
+    public function DrawRectangleGradientH(int|float $posX, int|float $posY, int|float $width, int|float $height, CData $left, CData $right): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawRectangleGradientH((int) $posX, (int) $posY, (int) $width, (int) $height, $left, $right);
+    }
+
+    /** Draw a gradient-filled rectangle with custom vertex colors */
+    public function DrawRectangleGradientEx(CData $rec, CData $topLeft, CData $bottomLeft, CData $topRight, CData $bottomRight): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawRectangleGradientEx($rec, $topLeft, $bottomLeft, $topRight, $bottomRight);
+    }
+
+    /** Draw rectangle outline */
+    public function DrawRectangleLines(int|float $posX, int|float $posY, int|float $width, int|float $height, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawRectangleLines((int) $posX, (int) $posY, (int) $width, (int) $height, $color);
+    }
+
+    /** Draw rectangle outline with extended parameters */
+    public function DrawRectangleLinesEx(CData $rec, float $lineThick, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawRectangleLinesEx($rec, $lineThick, $color);
+    }
+
+    /** Draw rectangle with rounded edges */
+    public function DrawRectangleRounded(CData $rec, float $roundness, int|float $segments, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawRectangleRounded($rec, $roundness, (int) $segments, $color);
+    }
+
+    /** Draw rectangle lines with rounded edges */
+    public function DrawRectangleRoundedLines(CData $rec, float $roundness, int|float $segments, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawRectangleRoundedLines($rec, $roundness, (int) $segments, $color);
+    }
+
+    /** Draw rectangle with rounded edges outline */
+    public function DrawRectangleRoundedLinesEx(CData $rec, float $roundness, int|float $segments, float $lineThick, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawRectangleRoundedLinesEx($rec, $roundness, (int) $segments, $lineThick, $color);
+    }
+
+    /** Draw a color-filled triangle (vertex in counter-clockwise order!) */
+    public function DrawTriangle(CData $v1, CData $v2, CData $v3, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawTriangle($v1, $v2, $v3, $color);
+    }
+
+    /** Draw triangle outline (vertex in counter-clockwise order!) */
+    public function DrawTriangleLines(CData $v1, CData $v2, CData $v3, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawTriangleLines($v1, $v2, $v3, $color);
+    }
+
+    /** Draw a triangle fan defined by points (first vertex is the center) */
+    public function DrawTriangleFan(?CData $points, int|float $pointCount, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawTriangleFan($points, (int) $pointCount, $color);
+    }
+
+    /** Draw a triangle strip defined by points */
+    public function DrawTriangleStrip(?CData $points, int|float $pointCount, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawTriangleStrip($points, (int) $pointCount, $color);
+    }
+
+    /** Draw a regular polygon (Vector version) */
+    public function DrawPoly(CData $center, int|float $sides, float $radius, float $rotation, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawPoly($center, (int) $sides, $radius, $rotation, $color);
+    }
+
+    /** Draw a polygon outline of n sides */
+    public function DrawPolyLines(CData $center, int|float $sides, float $radius, float $rotation, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawPolyLines($center, (int) $sides, $radius, $rotation, $color);
+    }
+
+    /** Draw a polygon outline of n sides with extended parameters */
+    public function DrawPolyLinesEx(CData $center, int|float $sides, float $radius, float $rotation, float $lineThick, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawPolyLinesEx($center, (int) $sides, $radius, $rotation, $lineThick, $color);
+    }
+
+    /** Draw spline: Linear, minimum 2 points */
+    public function DrawSplineLinear(?CData $points, int|float $pointCount, float $thick, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawSplineLinear($points, (int) $pointCount, $thick, $color);
+    }
+
+    /** Draw spline: B-Spline, minimum 4 points */
+    public function DrawSplineBasis(?CData $points, int|float $pointCount, float $thick, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawSplineBasis($points, (int) $pointCount, $thick, $color);
+    }
+
+    /** Draw spline: Catmull-Rom, minimum 4 points */
+    public function DrawSplineCatmullRom(?CData $points, int|float $pointCount, float $thick, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawSplineCatmullRom($points, (int) $pointCount, $thick, $color);
+    }
+
+    /** Draw spline: Quadratic Bezier, minimum 3 points (1 control point): [p1, c2, p3, c4...] */
+    public function DrawSplineBezierQuadratic(?CData $points, int|float $pointCount, float $thick, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawSplineBezierQuadratic($points, (int) $pointCount, $thick, $color);
+    }
+
+    /** Draw spline: Cubic Bezier, minimum 4 points (2 control points): [p1, c2, c3, p4, c5, c6...] */
+    public function DrawSplineBezierCubic(?CData $points, int|float $pointCount, float $thick, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawSplineBezierCubic($points, (int) $pointCount, $thick, $color);
+    }
+
+    /** Draw spline segment: Linear, 2 points */
+    public function DrawSplineSegmentLinear(CData $p1, CData $p2, float $thick, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawSplineSegmentLinear($p1, $p2, $thick, $color);
+    }
+
+    /** Draw spline segment: B-Spline, 4 points */
+    public function DrawSplineSegmentBasis(CData $p1, CData $p2, CData $p3, CData $p4, float $thick, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawSplineSegmentBasis($p1, $p2, $p3, $p4, $thick, $color);
+    }
+
+    /** Draw spline segment: Catmull-Rom, 4 points */
+    public function DrawSplineSegmentCatmullRom(CData $p1, CData $p2, CData $p3, CData $p4, float $thick, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawSplineSegmentCatmullRom($p1, $p2, $p3, $p4, $thick, $color);
+    }
+
+    /** Draw spline segment: Quadratic Bezier, 2 points, 1 control point */
+    public function DrawSplineSegmentBezierQuadratic(CData $p1, CData $c2, CData $p3, float $thick, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawSplineSegmentBezierQuadratic($p1, $c2, $p3, $thick, $color);
+    }
+
+    /** Draw spline segment: Cubic Bezier, 2 points, 2 control points */
+    public function DrawSplineSegmentBezierCubic(CData $p1, CData $c2, CData $c3, CData $p4, float $thick, CData $color): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawSplineSegmentBezierCubic($p1, $c2, $c3, $p4, $thick, $color);
+    }
+
+    /** Get (evaluate) spline point: Linear */
+    public function GetSplinePointLinear(CData $startPos, CData $endPos, float $t): CData
+    {
+        return $this->ffi->GetSplinePointLinear($startPos, $endPos, $t);
+    }
+
+    /** Get (evaluate) spline point: B-Spline */
+    public function GetSplinePointBasis(CData $p1, CData $p2, CData $p3, CData $p4, float $t): CData
+    {
+        return $this->ffi->GetSplinePointBasis($p1, $p2, $p3, $p4, $t);
+    }
+
+    /** Get (evaluate) spline point: Catmull-Rom */
+    public function GetSplinePointCatmullRom(CData $p1, CData $p2, CData $p3, CData $p4, float $t): CData
+    {
+        return $this->ffi->GetSplinePointCatmullRom($p1, $p2, $p3, $p4, $t);
+    }
+
+    /** Get (evaluate) spline point: Quadratic Bezier */
+    public function GetSplinePointBezierQuad(CData $p1, CData $c2, CData $p3, float $t): CData
+    {
+        return $this->ffi->GetSplinePointBezierQuad($p1, $c2, $p3, $t);
+    }
+
+    /** Get (evaluate) spline point: Cubic Bezier */
+    public function GetSplinePointBezierCubic(CData $p1, CData $c2, CData $c3, CData $p4, float $t): CData
+    {
+        return $this->ffi->GetSplinePointBezierCubic($p1, $c2, $c3, $p4, $t);
+    }
+
+    /** Check collision between two rectangles */
+    public function CheckCollisionRecs(CData $rec1, CData $rec2): bool
+    {
+        return $this->ffi->CheckCollisionRecs($rec1, $rec2);
+    }
+
+    /** Check collision between two circles */
+    public function CheckCollisionCircles(CData $center1, float $radius1, CData $center2, float $radius2): bool
+    {
+        return $this->ffi->CheckCollisionCircles($center1, $radius1, $center2, $radius2);
+    }
+
+    /** Check collision between circle and rectangle */
+    public function CheckCollisionCircleRec(CData $center, float $radius, CData $rec): bool
+    {
+        return $this->ffi->CheckCollisionCircleRec($center, $radius, $rec);
+    }
+
+    /** Check if circle collides with a line created betweeen two points [p1] and [p2] */
+    public function CheckCollisionCircleLine(CData $center, float $radius, CData $p1, CData $p2): bool
+    {
+        return $this->ffi->CheckCollisionCircleLine($center, $radius, $p1, $p2);
+    }
+
+    /** Check if point is inside rectangle */
+    public function CheckCollisionPointRec(CData $point, CData $rec): bool
+    {
+        return $this->ffi->CheckCollisionPointRec($point, $rec);
+    }
+
+    /** Check if point is inside circle */
+    public function CheckCollisionPointCircle(CData $point, CData $center, float $radius): bool
+    {
+        return $this->ffi->CheckCollisionPointCircle($point, $center, $radius);
+    }
+
+    /** Check if point is inside a triangle */
+    public function CheckCollisionPointTriangle(CData $point, CData $p1, CData $p2, CData $p3): bool
+    {
+        return $this->ffi->CheckCollisionPointTriangle($point, $p1, $p2, $p3);
+    }
+
+    /** Check if point belongs to line created between two points [p1] and [p2] with defined margin in pixels [threshold] */
+    public function CheckCollisionPointLine(CData $point, CData $p1, CData $p2, int|float $threshold): bool
+    {
+        return $this->ffi->CheckCollisionPointLine($point, $p1, $p2, (int) $threshold);
+    }
+
+    /** Check if point is within a polygon described by array of vertices */
+    public function CheckCollisionPointPoly(CData $point, ?CData $points, int|float $pointCount): bool
+    {
+        return $this->ffi->CheckCollisionPointPoly($point, $points, (int) $pointCount);
+    }
+
+    /** Check the collision between two lines defined by two points each, returns collision point by reference */
+    public function CheckCollisionLines(CData $startPos1, CData $endPos1, CData $startPos2, CData $endPos2, ?CData $collisionPoint): bool
+    {
+        return $this->ffi->CheckCollisionLines($startPos1, $endPos1, $startPos2, $endPos2, $collisionPoint);
+    }
+
+    /** Get collision rectangle for two rectangles collision */
+    public function GetCollisionRec(CData $rec1, CData $rec2): CData
+    {
+        return $this->ffi->GetCollisionRec($rec1, $rec2);
+    }
+
+    /** Load image from GPU texture data */
+    public function LoadImageFromTexture(CData $texture): CData
+    {
+        $this->drawList?->flush();
+        return $this->ffi->LoadImageFromTexture($texture);
+    }
+
+    /** Unload image from CPU memory (RAM) */
+    public function UnloadImage(CData $image): void
+    {
+        $this->ffi->UnloadImage($image);
+    }
+
+    /** Load texture for rendering (framebuffer) */
+    public function LoadRenderTexture(int|float $width, int|float $height): CData
+    {
+        return $this->ffi->LoadRenderTexture((int) $width, (int) $height);
+    }
+
+    /** Check if a render texture is valid (loaded in GPU) */
+    public function IsRenderTextureValid(CData $target): bool
+    {
+        return $this->ffi->IsRenderTextureValid($target);
+    }
+
+    /** Unload render texture from GPU memory (VRAM) */
+    public function UnloadRenderTexture(CData $target): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->UnloadRenderTexture($target);
+    }
+
+    /** Draw a Texture2D */
+    public function DrawTexture(CData $texture, int|float $posX, int|float $posY, CData $tint): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawTexture($texture, (int) $posX, (int) $posY, $tint);
+    }
+
+    /** Draw a part of a texture defined by a rectangle */
+    public function DrawTextureRec(CData $texture, CData $source, CData $position, CData $tint): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawTextureRec($texture, $source, $position, $tint);
+    }
+
+    /** Get the default Font */
+    public function GetFontDefault(): CData
+    {
+        return $this->ffi->GetFontDefault();
+    }
+
+    /** Load font from file into GPU memory (VRAM) */
+    public function LoadFont(CData|string|null $fileName): CData
+    {
+        return $this->ffi->LoadFont($fileName);
+    }
+
+    /** Load font from file with extended parameters, use NULL for codepoints and 0 for codepointCount to load the default character set */
+    public function LoadFontEx(CData|string|null $fileName, int|float $fontSize, ?CData $codepoints, int|float $codepointCount): CData
+    {
+        return $this->ffi->LoadFontEx($fileName, (int) $fontSize, $codepoints, (int) $codepointCount);
+    }
+
+    /** Check if a font is valid (font data loaded, WARNING: GPU texture not checked) */
+    public function IsFontValid(CData $font): bool
+    {
+        return $this->ffi->IsFontValid($font);
+    }
+
+    /** Unload font from GPU memory (VRAM) */
+    public function UnloadFont(CData $font): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->UnloadFont($font);
+    }
+
+    /** Draw text using font and additional parameters */
+    public function DrawTextEx(CData $font, CData|string|null $text, CData $position, float $fontSize, float $spacing, CData $tint): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->DrawTextEx($font, $text, $position, $fontSize, $spacing, $tint);
+    }
+
+    /** Measure string size for Font */
+    public function MeasureTextEx(CData $font, CData|string|null $text, float $fontSize, float $spacing): CData
+    {
+        return $this->ffi->MeasureTextEx($font, $text, $fontSize, $spacing);
+    }
+
+    /** Set texture scaling filter mode */
+    public function SetTextureFilter(CData $texture, int|float $filter): void
+    {
+        $this->drawList?->flush();
+        $this->ffi->SetTextureFilter($texture, (int) $filter);
+    }
+}
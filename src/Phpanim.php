@@ -25,19 +25,12 @@ class Phpanim extends Application
     {
         $definition = parent::getDefinition();
 
-        $defaultDll = match (PHP_OS_FAMILY) {
-            'Windows' => __DIR__ . '/../lib/libraylib.dll',
-            'Darwin' => __DIR__ . '/../lib/libraylib.dylib',
-            'Linux' => __DIR__ . '/../lib/libraylib.so',
-            default => null,
-        };
-
         $definition->addOption(new InputOption(
             name: '--raylib-dll-path',
             shortcut: 'r',
             mode: InputOption::VALUE_REQUIRED,
             description: 'Path to the raylib dynamic library',
-            default: $defaultDll,
+            default: self::library('raylib'),
         ));
 
         $definition->addOption(new InputOption(
@@ -48,6 +41,25 @@ class Phpanim extends Application
             default: __DIR__ . '/../lib/raylib.h',
         ));
 
+        $definition->addOption(new InputOption(
+            name: '--draw-shim-path',
+            mode: InputOption::VALUE_REQUIRED,
+            description: 'Path to the native draw list library, draw lists are replayed in PHP when it is missing',
+            default: self::library('phpanim_draw'),
+        ));
+
+        $definition->addOption(new InputOption(
+            name: '--profile',
+            mode: InputOption::VALUE_NONE,
+            description: 'Time plugins, scenes and schedulers per frame and count FFI calls',
+        ));
+
+        $definition->addOption(new InputOption(
+            name: '--profile-output',
+            mode: InputOption::VALUE_REQUIRED,
+            description: 'Write a Chrome trace-event JSON file of the profile, implies --profile',
+        ));
+
         $definition->addOption(new InputOption(
             name: '--plugin-path',
             shortcut: 'p',
@@ -56,6 +68,25 @@ class Phpanim extends Application
             default: getcwd(),
         ));
 
+        $definition->addOption(new InputOption(
+            name: '--plugin-manifest',
+            mode: InputOption::VALUE_REQUIRED,
+            description: 'Cache the list of plugin files in this file instead of scanning the plugin path on every start',
+        ));
+
         return $definition;
     }
+
+    /**
+     * Path of a library bundled in the lib directory for the current OS.
+     */
+    public static function library(string $name): ?string
+    {
+        return match (PHP_OS_FAMILY) {
+            'Windows' => __DIR__ . "/../lib/lib{$name}.dll",
+            'Darwin' => __DIR__ . "/../lib/lib{$name}.dylib",
+            'Linux' => __DIR__ . "/../lib/lib{$name}.so",
+            default => null,
+        };
+    }
 }
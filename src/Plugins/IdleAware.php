@@ -0,0 +1,24 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Plugins;
+
+use Aashan\Phpanim\Raylib;
+
+/**
+ * Implemented by plugins and scenes that can tell when their next update
+ * will change what is on screen, so the render loop can stop redrawing a
+ * still frame.
+ *
+ * Plugins and scenes that do not implement it are redrawn every frame.
+ */
+interface IdleAware
+{
+    /**
+     * Seconds until the next update changes anything: 0.0 when it may
+     * change something right away, INF when nothing is scheduled at all and
+     * only input could change the frame.
+     */
+    public function nextUpdateIn(Raylib $raylib): float;
+}
@@ -12,37 +12,74 @@ final class PluginManager
 {
     private array $plugins = [];
 
+    /** @var array<string, string> File each plugin was included from, by plugin name */
+    private array $files = [];
+
+    private bool $initialized = false;
+
+    private bool $fromManifest = false;
+
     public function __construct(
         private string $path,
+        ?string $manifest = null, // File caching the plugin file list, the path is scanned every time without it
     ) {
-        $finder = new Finder();
-        $finder->files()->in($this->path)->name('*.php')->depth('== 0');
-
-        foreach ($finder as $file) {
-            $plugin = include $file->getRealPath();
+        foreach ($this->discover($manifest) as $file) {
+            $plugin = include $file;
 
             if ($plugin instanceof PluginInterface) {
                 $this->register($plugin);
+                $this->files[$plugin->getName()] = $file;
             }
         }
     }
 
+    /**
+     * Whether the plugin files came from the manifest rather than a scan.
+     */
+    public function isFromManifest(): bool
+    {
+        return $this->fromManifest;
+    }
+
     public function register(PluginInterface $plugin): self
     {
         $this->plugins[$plugin->getName()] = $plugin;
         return $this;
     }
 
+    /**
+     * @return array<string, PluginInterface>
+     */
+    public function getPlugins(): array
+    {
+        return $this->plugins;
+    }
+
+    /**
+     * The file a plugin was included from, null for plugins registered in code.
+     */
+    public function getFile(string $name): ?string
+    {
+        return $this->files[$name] ?? null;
+    }
+
     public function initialize(Raylib $raylib): self
     {
         foreach ($this->plugins as $plugin) {
             $plugin->register($raylib);
         }
+        $this->initialized = true;
         return $this;
     }
 
     public function unregister(Raylib $raylib): self
     {
+        if (!$this->initialized) {
+            return $this;
+        }
+
+        $this->initialized = false;
+
         foreach ($this->plugins as $plugin) {
             $plugin->unregister($raylib);
             unset($this->plugins[$plugin->getName()]);
@@ -65,10 +102,96 @@ final class PluginManager
         return new Scheduler($raylib, new \stdClass())->parallel($schedulers);
     }
 
-    public function update(Raylib $raylib): void
+    /**
+     * Lists the plugin files, from the manifest while the plugin directory
+     * has not changed since it was written.
+     *
+     * Adding, removing or renaming a file changes the directory's mtime, so
+     * the manifest is rebuilt then. Editing a plugin does not need a rebuild
+     * as the files are included either way.
+     *
+     * @return string[]
+     */
+    private function discover(?string $manifest): array
+    {
+        $path = realpath($this->path) ?: $this->path;
+        $modified = filemtime($path);
+
+        if ($manifest !== null && is_file($manifest)) {
+            $cached = include $manifest;
+
+            if (is_array($cached) && $cached['path'] === $path && $cached['modified'] === $modified) {
+                $this->fromManifest = true;
+                return $cached['files'];
+            }
+        }
+
+        $finder = new Finder();
+        $finder->files()->in($path)->name('*.php')->depth('== 0');
+
+        $files = [];
+        foreach ($finder as $file) {
+            $files[] = $file->getRealPath();
+        }
+
+        if ($manifest !== null) {
+            $this->writeManifest($manifest, ['path' => $path, 'modified' => $modified, 'files' => $files]);
+        }
+
+        return $files;
+    }
+
+    /**
+     * Written as PHP so opcache keeps it in memory, and renamed into place
+     * so concurrent runs never include a half written file.
+     */
+    private function writeManifest(string $manifest, array $data): void
     {
+        $temporary = $manifest . '.' . getmypid() . '.tmp';
+
+        if (@file_put_contents($temporary, '<?php return ' . var_export($data, true) . ";\n") === false) {
+            return; // Not being able to cache only costs a scan next time
+        }
+
+        if (!@rename($temporary, $manifest)) {
+            @unlink($temporary);
+        }
+
+        if (function_exists('opcache_invalidate')) {
+            opcache_invalidate($manifest, true);
+        }
+    }
+
+    /**
+     * Seconds until any plugin changes what is on screen, see IdleAware.
+     * Plugins that do not implement it are always busy.
+     */
+    public function nextUpdateIn(Raylib $raylib): float
+    {
+        $next = INF;
+
         foreach ($this->plugins as $plugin) {
+            if (!$plugin instanceof IdleAware) {
+                return 0.0;
+            }
+
+            $next = min($next, $plugin->nextUpdateIn($raylib));
+            if ($next <= 0.0) {
+                return 0.0;
+            }
+        }
+
+        return $next;
+    }
+
+    public function update(Raylib $raylib): void
+    {
+        $profiler = $raylib->profiler();
+
+        foreach ($this->plugins as $name => $plugin) {
+            $profiler?->begin($name, 'plugin');
             $plugin->update($raylib);
+            $profiler?->end();
         }
     }
 }
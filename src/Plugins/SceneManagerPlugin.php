@@ -10,10 +10,16 @@ use Aashan\Phpanim\Scheduler;
 use Fiber;
 use stdClass;
 
-final class SceneManagerPlugin extends Plugin
+final class SceneManagerPlugin extends Plugin implements IdleAware
 {
     private array $scenes = [];
 
+    // Position of the scene running now in $scenes
+    private int $index = 0;
+
+    /** @var array<string, int> Frames left to skip by scene name */
+    private array $skipped = [];
+
     private bool $locked = false;
 
     private Scheduler $scheduler;
@@ -29,12 +35,23 @@ final class SceneManagerPlugin extends Plugin
             callback: fn(SceneInterface $scene) => $scene->load($raylib),
         );
 
+        $this->index = 0;
+
         $this->scheduler->manual(function () use ($raylib) {
-            foreach ($this->scenes as $scene) {
-                while (!$scene->done($raylib)) {
-                    $scene->update($raylib);
-                    Fiber::suspend();
+            while (($name = $this->current($raylib)) !== null) {
+                if (isset($this->skipped[$name])) {
+                    if (--$this->skipped[$name] === 0) {
+                        unset($this->skipped[$name]);
+                        $this->index++;
+                    }
+                } else {
+                    $profiler = $raylib->profiler();
+                    $profiler?->begin("scene {$name}", 'scene');
+                    $this->scenes[$name]->update($raylib);
+                    $profiler?->end();
                 }
+
+                Fiber::suspend();
             }
         });
 
@@ -56,6 +73,66 @@ final class SceneManagerPlugin extends Plugin
         $this->scheduler->update();
     }
 
+    /**
+     * Asks the running scene when it next changes, scenes that cannot tell
+     * are redrawn every frame. After the last scene nothing changes anymore.
+     */
+    public function nextUpdateIn(Raylib $raylib): float
+    {
+        $name = $this->current($raylib);
+
+        return match (true) {
+            $name === null => INF,
+            isset($this->skipped[$name]) => 0.0,
+            $this->scenes[$name] instanceof IdleAware => $this->scenes[$name]->nextUpdateIn($raylib),
+            default => 0.0,
+        };
+    }
+
+    /**
+     * Name of the scene the next update runs, null once every scene is done.
+     */
+    public function current(Raylib $raylib): ?string
+    {
+        $names = array_keys($this->scenes);
+
+        while ($this->index < count($names)) {
+            $name = $names[$this->index];
+
+            if (isset($this->skipped[$name]) || !$this->scenes[$name]->done($raylib)) {
+                return $name;
+            }
+
+            $this->index++;
+        }
+
+        return null;
+    }
+
+    /**
+     * Lets the scene take $frames updates without updating it, then moves
+     * on to the next one. Used by the export cache when the frames of a scene
+     * are already encoded.
+     */
+    public function skip(string $name, int $frames): void
+    {
+        if (!isset($this->scenes[$name])) {
+            throw new \InvalidArgumentException("Unknown scene {$name}.");
+        }
+
+        if ($frames > 0) {
+            $this->skipped[$name] = $frames;
+        }
+    }
+
+    /**
+     * @return array<string, SceneInterface>
+     */
+    public function getScenes(): array
+    {
+        return $this->scenes;
+    }
+
     public function addScene(string $name, SceneInterface $scene): self
     {
         if ($this->locked) {
@@ -0,0 +1,59 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Profiling;
+
+use FFI;
+use FFI\CData;
+use FFI\CType;
+
+/**
+ * Wraps an FFI handle and counts every C function called through it.
+ *
+ * Raylib calls its handle for the generated methods and code may call
+ * $rl->ffi directly, so counting at the handle catches both. Allocations
+ * and casts are forwarded without counting, they never cross into C.
+ */
+final class CountingFfi
+{
+    public int $calls = 0;
+
+    public function __construct(
+        private readonly FFI $ffi,
+    ) {
+    }
+
+    public function __call(string $name, array $arguments): mixed
+    {
+        ++$this->calls;
+
+        return $this->ffi->{$name}(...$arguments);
+    }
+
+    public function new(CType|string $type, bool $owned = true, bool $persistent = false): ?CData
+    {
+        return $this->ffi->new($type, $owned, $persistent);
+    }
+
+    public function cast(CType|string $type, mixed $ptr): ?CData
+    {
+        return $this->ffi->cast($type, $ptr);
+    }
+
+    public function type(string $type): ?CType
+    {
+        return $this->ffi->type($type);
+    }
+
+    // C variables declared in the header
+    public function __get(string $name): mixed
+    {
+        return $this->ffi->{$name};
+    }
+
+    public function __set(string $name, mixed $value): void
+    {
+        $this->ffi->{$name} = $value;
+    }
+}
@@ -0,0 +1,25 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Profiling;
+
+use Aashan\Phpanim\Raylib;
+use FFI;
+
+/**
+ * Raylib that counts every call crossing into FFI. Only used while
+ * profiling, so the regular binding pays nothing for it.
+ */
+final class CountingRaylib extends Raylib
+{
+    public function calls(): int
+    {
+        return $this->ffi->calls;
+    }
+
+    protected function bind(FFI $ffi): CountingFfi
+    {
+        return new CountingFfi($ffi);
+    }
+}
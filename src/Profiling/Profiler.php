@@ -0,0 +1,334 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Profiling;
+
+use Aashan\Phpanim\Raylib;
+
+/**
+ * Times named spans (plugins, scenes, schedulers, draw list flushes) per frame.
+ *
+ * Instrumented code reaches the profiler through Raylib::profiler(), which
+ * is null unless profiling was requested, and calls it with the nullsafe
+ * operator so nothing is evaluated when it is off. Spans can be shown on an
+ * on-screen HUD and streamed into a Chrome trace-event file that can be
+ * opened with chrome://tracing or https://ui.perfetto.dev.
+ */
+final class Profiler
+{
+    // Number of spans listed on the HUD
+    private const HUD_SPANS = 8;
+
+    /** @var array<int, array{string, string, int}> Open spans as [name, category, start] */
+    private array $stack = [];
+
+    /** @var array<string, array{string, int, int}> Spans of the current frame as name => [category, nanoseconds, count] */
+    private array $spans = [];
+
+    /** @var array<string, array{string, int, int}> Same as $spans, summed over all frames */
+    private array $totals = [];
+
+    private array $lastFrame = [];
+
+    private int $frames = 0;
+    private int $frameTime = 0;
+    private int $frameCalls = 0;
+
+    private int $frameStart = 0;
+    private int $callsAtStart = 0;
+    private int $extraCalls = 0;
+
+    /** @var string[] Encoded trace events not written yet */
+    private array $events = [];
+
+    /** @var resource|null */
+    private $trace = null;
+
+    private bool $traceEmpty = true;
+    private int $origin;
+    private int $pid;
+
+    public function __construct(
+        private Raylib $rl,
+        ?string $tracePath = null,
+        private bool $hud = true,
+    ) {
+        $this->origin = hrtime(true);
+        $this->pid = getmypid();
+
+        if ($tracePath !== null) {
+            $this->openTrace($tracePath, 'phpanim');
+        }
+    }
+
+    public function beginFrame(): void
+    {
+        $this->spans = [];
+        $this->extraCalls = 0;
+        $this->callsAtStart = $this->calls();
+        $this->frameStart = hrtime(true);
+    }
+
+    public function endFrame(): void
+    {
+        $duration = hrtime(true) - $this->frameStart;
+        $calls = $this->calls() - $this->callsAtStart + $this->extraCalls;
+
+        $this->lastFrame = [
+            'frame' => $this->frames,
+            'time' => $duration,
+            'calls' => $calls,
+            'memory' => memory_get_usage(),
+            'peak' => memory_get_peak_usage(),
+            'spans' => $this->spans,
+        ];
+
+        foreach ($this->spans as $name => [$category, $time, $count]) {
+            if (isset($this->totals[$name])) {
+                $this->totals[$name][1] += $time;
+                $this->totals[$name][2] += $count;
+            } else {
+                $this->totals[$name] = [$category, $time, $count];
+            }
+        }
+
+        $this->frames++;
+        $this->frameTime += $duration;
+        $this->frameCalls += $calls;
+
+        if ($this->trace !== null) {
+            $this->events[] = $this->event('frame', 'frame', $this->frameStart, $duration, ['frame' => $this->lastFrame['frame']]);
+            $this->events[] = $this->counter('ffi calls', ['calls' => $calls]);
+            $this->events[] = $this->counter('memory', [
+                'usage' => $this->lastFrame['memory'],
+                'peak' => $this->lastFrame['peak'],
+            ]);
+
+            $this->writeEvents();
+        }
+    }
+
+    public function begin(string $name, string $category = 'function'): void
+    {
+        $this->stack[] = [$name, $category, hrtime(true)];
+    }
+
+    public function end(): void
+    {
+        $end = hrtime(true);
+        [$name, $category, $start] = array_pop($this->stack);
+        $duration = $end - $start;
+
+        if (isset($this->spans[$name])) {
+            $this->spans[$name][1] += $duration;
+            $this->spans[$name][2]++;
+        } else {
+            $this->spans[$name] = [$category, $duration, 1];
+        }
+
+        if ($this->trace !== null) {
+            $this->events[] = $this->event($name, $category, $start, $duration);
+        }
+    }
+
+    /**
+     * Counts FFI calls that do not go through the Raylib instance, e.g. a
+     * native draw list flush.
+     */
+    public function countCalls(int $calls): void
+    {
+        $this->extraCalls += $calls;
+    }
+
+    /**
+     * Draws the spans of the last finished frame in the top-right corner.
+     */
+    public function drawHud(): void
+    {
+        if (!$this->hud || $this->lastFrame === []) {
+            return;
+        }
+
+        $frame = $this->lastFrame;
+        $spans = $frame['spans'];
+        uasort($spans, static fn(array $a, array $b) => $b[1] <=> $a[1]);
+
+        $lines = [
+            sprintf('frame %d: %.2f ms, %d ffi calls', $frame['frame'], $frame['time'] / 1e6, $frame['calls']),
+            sprintf('memory %.1f MB, peak %.1f MB', $frame['memory'] / 1048576, $frame['peak'] / 1048576),
+        ];
+
+        foreach (array_slice($spans, 0, self::HUD_SPANS, true) as $name => [$category, $time, $count]) {
+            $lines[] = sprintf('%7.2f ms  %s%s', $time / 1e6, $name, $count > 1 ? " x{$count}" : '');
+        }
+
+        $width = 320;
+        $x = $this->rl->GetScreenWidth() - $width - 10;
+
+        $this->rl->DrawRectangle($x, 10, $width, 10 + 14 * count($lines), $this->rl->color(0x000000C0));
+
+        foreach ($lines as $i => $line) {
+            $this->rl->DrawText($line, $x + 8, 15 + 14 * $i, 10, $this->rl->color(0xFFFFFFFF));
+        }
+    }
+
+    /**
+     * Average time and count per frame of every span seen so far, slowest first.
+     *
+     * @return array<int, array{string, string, float, float}> Rows of [name, category, milliseconds, count]
+     */
+    public function summary(): array
+    {
+        if ($this->frames === 0) {
+            return [];
+        }
+
+        $rows = [
+            ['frame', 'frame', $this->frameTime / 1e6 / $this->frames, 1.0],
+            ['ffi calls', 'ffi', 0.0, $this->frameCalls / $this->frames],
+        ];
+
+        $totals = $this->totals;
+        uasort($totals, static fn(array $a, array $b) => $b[1] <=> $a[1]);
+
+        foreach ($totals as $name => [$category, $time, $count]) {
+            $rows[] = [$name, $category, $time / 1e6 / $this->frames, $count / $this->frames];
+        }
+
+        return $rows;
+    }
+
+    public function frames(): int
+    {
+        return $this->frames;
+    }
+
+    /**
+     * Switches the trace to a new file, used by forked export workers so
+     * they do not write into the parent's trace.
+     */
+    public function redirect(string $path, string $process): void
+    {
+        if ($this->trace === null) {
+            return;
+        }
+
+        fclose($this->trace);
+        $this->trace = null;
+
+        $this->pid = getmypid();
+        $this->events = [];
+        $this->openTrace($path, $process);
+    }
+
+    /**
+     * Appends the events of traces written by other processes.
+     *
+     * @param string[] $paths
+     */
+    public function merge(array $paths): void
+    {
+        if ($this->trace === null) {
+            return;
+        }
+
+        foreach ($paths as $path) {
+            $handle = @fopen($path, 'r');
+            if ($handle === false) {
+                continue;
+            }
+
+            while (($line = fgets($handle)) !== false) {
+                $line = rtrim($line, ",\n");
+
+                if ($line !== '' && $line !== '[' && $line !== ']') {
+                    $this->events[] = $line;
+                }
+            }
+
+            fclose($handle);
+            $this->writeEvents();
+        }
+    }
+
+    public function close(): void
+    {
+        if ($this->trace === null) {
+            return;
+        }
+
+        $this->writeEvents();
+        fwrite($this->trace, "\n]\n");
+        fclose($this->trace);
+        $this->trace = null;
+    }
+
+    private function calls(): int
+    {
+        return $this->rl instanceof CountingRaylib ? $this->rl->calls() : 0;
+    }
+
+    private function openTrace(string $path, string $process): void
+    {
+        $trace = fopen($path, 'w');
+
+        if ($trace === false) {
+            throw new \RuntimeException("Unable to open the trace file {$path}.");
+        }
+
+        $this->trace = $trace;
+        $this->traceEmpty = true;
+
+        fwrite($this->trace, "[\n");
+
+        $this->events[] = json_encode([
+            'name' => 'process_name',
+            'ph' => 'M',
+            'pid' => $this->pid,
+            'args' => ['name' => $process],
+        ]);
+    }
+
+    private function writeEvents(): void
+    {
+        if ($this->events === []) {
+            return;
+        }
+
+        fwrite($this->trace, ($this->traceEmpty ? '' : ",\n") . implode(",\n", $this->events));
+
+        $this->events = [];
+        $this->traceEmpty = false;
+    }
+
+    private function event(string $name, string $category, int $start, int $duration, array $args = []): string
+    {
+        $event = [
+            'name' => $name,
+            'cat' => $category,
+            'ph' => 'X',
+            'ts' => ($start - $this->origin) / 1e3,
+            'dur' => $duration / 1e3,
+            'pid' => $this->pid,
+            'tid' => 0,
+        ];
+
+        if ($args !== []) {
+            $event['args'] = $args;
+        }
+
+        return json_encode($event);
+    }
+
+    private function counter(string $name, array $args): string
+    {
+        return json_encode([
+            'name' => $name,
+            'ph' => 'C',
+            'ts' => ($this->frameStart - $this->origin) / 1e3,
+            'pid' => $this->pid,
+            'args' => $args,
+        ]);
+    }
+}
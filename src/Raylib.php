@@ -4,45 +4,128 @@ declare(strict_types=1);
 
 namespace Aashan\Phpanim;
 
+use Aashan\Phpanim\Animation\Runtime;
+use Aashan\Phpanim\Clock\ClockInterface;
+use Aashan\Phpanim\Clock\RealtimeClock;
+use Aashan\Phpanim\Drawing\DrawList;
+use Aashan\Phpanim\Profiling\CountingFfi;
+use Aashan\Phpanim\Profiling\Profiler;
+use Aashan\Phpanim\Generated\RaylibFunctions;
 use FFI;
 use FFI\CData;
 
 /**
+ * Thin wrapper around the raylib FFI handle.
  *
- * @method void  InitWindow(int $width, int $height, string $title)
- * @method void  CloseWindow()
- *
- * @method bool  WindowShouldClose()
- * @method void  BeginDrawing()
- * @method void  EndDrawing()
- *
- * @method void  ClearBackground(CData $color)
- * @method void  DrawText(string $text, int $posX, int $posY, int $fontSize, CData $color)
- * @method void  DrawRectangle(int $posX, int $posY, int $width, int $height, CData $color)
- * @method void  DrawCircle(int $centerX, int $centerY, float $radius, CData $color)
- * @method void  DrawLine(int $startPosX, int $startPosY, int $endPosX, int $endPosY, CData $color)
- * @method void  DrawLineEx(CData $startPos, CData $endPos, float $thickness, CData $color)
- * @method void  DrawPixel(int $posX, int $posY, CData $color)
- * @method void  DrawTriangle(CData $v1, CData $v2, CData $v3, CData $color);
- *
- * @method int GetScreenWidth();
- * @method int GetScreenHeight();
- *
- * @method float GetFrameTime()
- * @method int   GetFPS()
- * @method void  SetTargetFPS(int $fps)
- * @method CData GetColor(int $hexValue)
+ * Every function in lib/raylib.h is available as a typed method generated
+ * into RaylibFunctions, calls to anything else fall back to __call().
  */
 class Raylib
 {
-    public readonly FFI $ffi;
+    use RaylibFunctions;
+
+    public const FLAG_WINDOW_HIDDEN = 0x00000080;
+
+    // FFI scope preload.php loads the definitions into
+    public const SCOPE = 'phpanim.raylib';
+
+    public readonly FFI|CountingFfi $ffi;
+
+    /** @var CData[] Render textures currently bound, innermost last */
+    private array $renderTargets = [];
+
+    private ?ClockInterface $clock = null;
+
+    // Flushed by the generated draw methods, see FLUSHES_DRAW_LIST
+    protected ?DrawList $drawList = null;
 
-    public function __construct(string $path, string $definition)
+    private ?Runtime $runtime = null;
+
+    private ?Profiler $profiler = null;
+
+    /** @var CData[] Interned colors by hex value */
+    private array $colors = [];
+
+    /** @var CData[] Interned structs by type and field values */
+    private array $constants = [];
+
+    /**
+     * @param string|null $path Path to the raylib library, null only declares the types
+     */
+    public function __construct(?string $path, string $definition)
     {
-        $this->ffi = FFI::cdef(
+        $this->ffi = $this->bind(FFI::cdef(
             code: $definition,
             lib: $path,
+        ));
+    }
+
+    /**
+     * Uses the definitions preload() parsed when the server started instead
+     * of parsing the header again.
+     */
+    public static function fromScope(): static
+    {
+        $raylib = new \ReflectionClass(static::class)->newInstanceWithoutConstructor();
+        $raylib->ffi = $raylib->bind(FFI::scope(self::SCOPE));
+
+        return $raylib;
+    }
+
+    public static function isPreloaded(): bool
+    {
+        try {
+            FFI::scope(self::SCOPE);
+            return true;
+        } catch (FFI\Exception) {
+            return false;
+        }
+    }
+
+    /**
+     * Parses the header into the FFI scope, only possible from an
+     * opcache.preload script.
+     *
+     * FFI::load() takes the library from the header, so a copy with the
+     * scope and library defines prepended is written to $cacheDirectory.
+     */
+    public static function preload(string $path, string $definitionPath, string $cacheDirectory): void
+    {
+        $header = sprintf(
+            "#define FFI_SCOPE \"%s\"\n#define FFI_LIB \"%s\"\n%s",
+            self::SCOPE,
+            addcslashes(realpath($path) ?: $path, '"\\'),
+            file_get_contents($definitionPath),
         );
+
+        if (!is_dir($cacheDirectory) && !@mkdir($cacheDirectory, 0777, true) && !is_dir($cacheDirectory)) {
+            throw new \RuntimeException("Unable to create the directory {$cacheDirectory}.");
+        }
+
+        $scoped = $cacheDirectory . '/raylib-' . md5($header) . '.h';
+        if (!file_exists($scoped)) {
+            file_put_contents($scoped, $header, LOCK_EX);
+        }
+
+        FFI::load($scoped);
+    }
+
+    /**
+     * A C header without its function prototypes. FFI::cdef() resolves
+     * every declared function when it is called, so a header loaded
+     * without a library may only declare types.
+     */
+    public static function typesOnly(string $header): string
+    {
+        return preg_replace('/^[A-Za-z_][\w\s]*[\s*]+[A-Za-z_]\w*\(.*\);.*$/m', '', $header);
+    }
+
+    /**
+     * The handle every call goes through, subclasses may wrap it.
+     */
+    protected function bind(FFI $ffi): FFI|CountingFfi
+    {
+        return $ffi;
     }
 
     public function __call(string $name, array $arguments): mixed
@@ -60,4 +143,106 @@ class Raylib
 
         return $type;
     }
+
+    /**
+     * Returns a shared Color for a 0xRRGGBBAA value, allocating it only on
+     * first use. The returned struct must not be modified.
+     */
+    public function color(int $hex): CData
+    {
+        return $this->colors[$hex] ??= $this->GetColor($hex);
+    }
+
+    /**
+     * Like struct(), but returns the same instance for the same type and
+     * fields. Meant for values that stay constant across frames, the
+     * returned struct must not be modified.
+     */
+    public function constant(string $name, array $params = []): CData
+    {
+        $key = $name . serialize($params);
+
+        return $this->constants[$key] ??= $this->struct($name, $params);
+    }
+
+    /**
+     * The clock animations advance by. Defaults to raylib's real frame time.
+     */
+    public function clock(): ClockInterface
+    {
+        return $this->clock ??= new RealtimeClock($this);
+    }
+
+    public function useClock(ClockInterface $clock): void
+    {
+        $this->clock = $clock;
+    }
+
+    /**
+     * The runtime schedulers started with Scheduler::play() run on, updated
+     * once per frame by the commands. Follows the clock set at the time it
+     * is first asked for.
+     */
+    public function runtime(): Runtime
+    {
+        return $this->runtime ??= new Runtime($this->clock());
+    }
+
+    /**
+     * The shared command buffer visualizations and plugins batch their draw
+     * calls into. Replays in PHP unless a native one was set with useDrawList().
+     */
+    public function drawList(): DrawList
+    {
+        return $this->drawList ??= new DrawList($this);
+    }
+
+    public function useDrawList(DrawList $drawList): void
+    {
+        $this->drawList?->flush();
+        $this->drawList = $drawList;
+    }
+
+    /**
+     * The active profiler, null unless profiling was enabled.
+     */
+    public function profiler(): ?Profiler
+    {
+        return $this->profiler;
+    }
+
+    public function useProfiler(?Profiler $profiler): void
+    {
+        $this->profiler = $profiler;
+    }
+
+    /**
+     * Begins drawing into a render texture, remembering the target that was
+     * active before so nested texture modes can be unwound correctly.
+     */
+    public function pushRenderTarget(CData $target): void
+    {
+        // Pending commands belong to the target that was bound when they were recorded
+        $this->drawList?->flush();
+
+        $this->renderTargets[] = $target;
+        $this->BeginTextureMode($target);
+    }
+
+    /**
+     * Ends drawing into the current render texture and rebinds the enclosing
+     * one, if any, instead of falling back to the screen.
+     */
+    public function popRenderTarget(): void
+    {
+        $this->drawList?->flush();
+
+        array_pop($this->renderTargets);
+        $this->EndTextureMode();
+
+        $previous = end($this->renderTargets);
+        if ($previous !== false) {
+            $this->BeginTextureMode($previous);
+        }
+    }
 }
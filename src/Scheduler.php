@@ -4,274 +4,425 @@ declare(strict_types=1);
 
 namespace Aashan\Phpanim;
 
+use Aashan\Phpanim\Animation\BufferMorphTrack;
+use Aashan\Phpanim\Animation\BufferRotateTrack;
+use Aashan\Phpanim\Animation\CallbackEasing;
+use Aashan\Phpanim\Animation\CustomTrack;
+use Aashan\Phpanim\Animation\EasingFunction;
+use Aashan\Phpanim\Animation\MorphTrack;
+use Aashan\Phpanim\Animation\Parallel;
+use Aashan\Phpanim\Animation\RotateTrack;
+use Aashan\Phpanim\Animation\Runtime;
+use Aashan\Phpanim\Animation\SchedulerEasing;
+use Aashan\Phpanim\Animation\Timeline;
+use Aashan\Phpanim\Animation\Track;
+use Aashan\Phpanim\Animation\TweenTrack;
+use Aashan\Phpanim\Animation\WaitTrack;
+use Aashan\Phpanim\Clock\ClockInterface;
+use Aashan\Phpanim\Types\Vec2Buffer;
+use Aashan\Phpanim\Visualizations\PointCloud;
+use Closure;
 use FFI\CData;
 use Fiber;
 
 class Scheduler
 {
+    /** @var array<Track|Parallel|Scheduler|callable> */
     protected $animations = [];
     private bool $started = false;
     private bool $repeat = false;
-    private $easingFunc = null;
+    private SchedulerEasing $easing;
 
-    private Fiber $fiber;
+    // Created on the first start() and sent round again on every run after it
+    private ?Fiber $fiber = null;
+
+    // Whether the Fiber has run through the sequence and waits for the next start()
+    private bool $finished = false;
+
+    /** @var array<int, array{Runtime, Scheduler[]}> Runtime and nested schedulers of parallel() and then() steps by position */
+    private array $nested = [];
+
+    private ClockInterface $clock;
+
+    // Clock time a parked scheduler is resumed at, null while it runs every frame
+    private ?float $wakeAt = null;
 
     public function __construct(
         private Raylib $rl,
         private object $target,
-    ) {}
+        ?ClockInterface $clock = null,
+    ) {
+        $this->clock = $clock ?? $rl->clock();
+        $this->easing = new SchedulerEasing();
+    }
 
-    private function readProperty(string $path): mixed
+    public function new(): self
     {
-        $parts = explode('.', $path);
-        $value = $this->target;
+        return new self($this->rl, $this->target, $this->clock);
+    }
 
-        foreach ($parts as $part) {
-            if (is_object($value) && property_exists($value, $part)) {
-                $value = $value->{$part};
-            } else {
-                throw new \RuntimeException("Property '{$path}' does not exist on target object.");
-            }
-        }
+    /**
+     * Sets the easing of every track in this scheduler that was added
+     * without an easing of its own.
+     */
+    public function withEasing(EasingFunction|callable $easing): self
+    {
+        $this->easing->easing = $easing instanceof EasingFunction ? $easing : new CallbackEasing(Closure::fromCallable($easing));
+        return $this;
+    }
 
-        return $value;
+    public function tween(string $property, float $from, float $to, float $duration, EasingFunction|callable|null $easing = null): self
+    {
+        return $this->add(new TweenTrack($this->target, [$property => [$from, $to]], $duration, $this->resolveEasing($easing)));
     }
 
-    private function writeProperty(string $path, mixed $newValue): void
+    /**
+     * Rotates a Vector2, or every point of a buffer as a single track.
+     */
+    public function rotate(CData|Vec2Buffer $point, float $deg, float $duration, null|CData $origin = null, EasingFunction|callable|null $easing = null): self
     {
-        $parts = explode('.', $path);
-        $value = &$this->target;
+        return $this->add($point instanceof Vec2Buffer
+            ? new BufferRotateTrack($point, $deg, $duration, $origin, $this->resolveEasing($easing))
+            : new RotateTrack($point, $deg, $duration, $origin, $this->resolveEasing($easing)));
+    }
 
-        foreach ($parts as $part) {
-            if (is_object($value) && property_exists($value, $part)) {
-                $value = &$value->{$part};
-            } else {
-                throw new \RuntimeException("Property '{$path}' does not exist on target object.");
-            }
+    /**
+     * Moves every point of a cloud or buffer to the matching point of $target.
+     */
+    public function morph(PointCloud|Vec2Buffer $points, PointCloud|Vec2Buffer $target, float $duration, EasingFunction|callable|null $easing = null): self
+    {
+        if ($points instanceof PointCloud && $target instanceof PointCloud) {
+            return $this->add(new MorphTrack($points, $target, $duration, $this->resolveEasing($easing)));
         }
 
-        $value = $newValue;
+        if ($points instanceof Vec2Buffer && $target instanceof Vec2Buffer) {
+            return $this->add(new BufferMorphTrack($points, $target, $duration, $this->resolveEasing($easing)));
+        }
+
+        throw new \InvalidArgumentException('Can only morph a point cloud into a point cloud and a buffer into a buffer.');
     }
 
-    public function new(): self
+    public function tweenMulti(float $duration, array $properties, EasingFunction|callable|null $easing = null): self
     {
-        return new self($this->rl, $this->target);
+        return $this->add(new TweenTrack($this->target, $properties, $duration, $this->resolveEasing($easing)));
     }
 
-    public function withEasing(callable $easingFunc): self
+    public function wait(float $duration): self
     {
-        $this->easingFunc = $easingFunc;
-        return $this;
+        return $this->add(new WaitTrack($duration));
     }
 
-    public function tween(string $property, float $from, float $to, float $duration): self
+    /**
+     * Runs a callable inside the scheduler's Fiber. The callable is free to
+     * call Fiber::suspend() to span several frames, which also means it cannot
+     * be placed on a seekable timeline.
+     */
+    public function manual(callable $fn): self
     {
-        $this->animations[] = function () use ($property, $from, $to, $duration) {
-            $t = 0.0;
-
-            while ($t < 1.0) {
-                $elapsed = $this->rl->GetFrameTime();
-                $t = min(1.0, (($t * $duration) + $elapsed) / $duration);
-
-                $value = $from + (($to - $from) * $this->applyEasing($t));
-                $this->writeProperty($property, $value);
-                Fiber::suspend();
-            }
-        };
-
+        $this->animations[] = $fn;
         return $this;
     }
 
-    public function rotate(CData $point, float $deg, float $duration, null|CData $origin = null): self
+    public function custom(callable $fn, float $duration): self
     {
-        $this->animations[] = function () use ($point, $deg, $duration, $origin) {
-            $startX = $point->x;
-            $startY = $point->y;
-
-            $angleRad = deg2rad($deg);
-            $cosAngle = cos($angleRad);
-            $sinAngle = sin($angleRad);
-
-            $originX = $origin ? $origin->x : 0.0;
-            $originY = $origin ? $origin->y : 0.0;
+        return $this->add(new CustomTrack(Closure::fromCallable($fn), $this->target, $duration));
+    }
 
-            $t = 0.0;
+    /**
+     * Appends any track to the sequence.
+     */
+    public function add(Track $track): self
+    {
+        $this->animations[] = $track;
+        return $this;
+    }
 
-            while ($t < 1.0) {
-                $elapsed = $this->rl->GetFrameTime();
-                $t = min(1.0, (($t * $duration) + $elapsed) / $duration);
+    public function parallel(array $schedulers): self
+    {
+        $this->animations[] = new Parallel(array_values($schedulers));
+        return $this;
+    }
 
-                $ease = $this->applyEasing($t);
-                $currentAngle = $angleRad * $ease;
+    public function then(Scheduler $scheduler): self
+    {
+        $this->animations[] = $scheduler;
+        return $this;
+    }
 
-                $rotatedX =
-                    (cos($currentAngle) * ($startX - $originX)) - (sin($currentAngle) * ($startY - $originY))
-                    + $originX;
-                $rotatedY =
-                    (sin($currentAngle) * ($startX - $originX))
-                    + (cos($currentAngle) * ($startY - $originY))
-                    + $originY;
+    public function start()
+    {
+        $this->wakeAt = null;
+        $this->started = true;
 
-                $point->x = $rotatedX;
-                $point->y = $rotatedY;
+        // A finished Fiber waits at the end of its loop, only a run cut short needs a new one
+        if ($this->finished) {
+            $this->finished = false;
+            $this->fiber->resume();
+            return;
+        }
 
-                Fiber::suspend();
-            }
-        };
+        $this->fiber = new Fiber($this->loop(...));
+        $this->fiber->start();
+    }
 
+    public function repeat(): self
+    {
+        $this->repeat = true;
         return $this;
     }
 
-    public function tweenMulti(float $duration, array $properties): self
+    /**
+     * Starts the scheduler on a runtime, by default the shared one the
+     * commands update every frame, instead of calling update() yourself.
+     * While in wait() it is not resumed at all.
+     */
+    public function play(?Runtime $runtime = null): self
     {
-        $this->animations[] = function () use ($properties, $duration) {
-            $elapsed = 0.0;
-            $t = 0.0;
-
-            while ($t < 1.0) {
-                $elapsed = $this->rl->GetFrameTime();
-                $t = min(1.0, (($t * $duration) + $elapsed) / $duration);
-
-                $ease = $this->applyEasing($t);
-                foreach ($properties as $property => [$from, $to]) {
-                    $value = $from + (($to - $from) * $ease);
-                    $this->writeProperty($property, $value);
-                }
+        if (!$this->started) {
+            $this->start();
+        }
 
-                Fiber::suspend();
-            }
-        };
+        ($runtime ?? $this->rl->runtime())->add($this);
 
         return $this;
     }
 
-    public function wait(float $duration): self
+    public function update()
     {
-        $this->animations[] = function () use ($duration) {
-            $elapsed = 0.0;
+        if (!$this->started) {
+            $this->start();
+        }
 
-            while ($elapsed < $duration) {
-                $elapsed += $this->rl->GetFrameTime();
+        // Parked in wait(), nothing to do until the wake time
+        if ($this->wakeAt !== null && $this->clock->getTime() + Runtime::EPSILON < $this->wakeAt) {
+            return;
+        }
 
-                Fiber::suspend();
-            }
-        };
-        return $this;
-    }
+        $profiler = $this->rl->profiler();
+        $profiler?->begin('Scheduler(' . get_debug_type($this->target) . ')', 'scheduler');
 
-    public function manual(callable $fn): self
-    {
-        $this->animations[] = $fn;
-        return $this;
+        if (!$this->finished && $this->fiber->isSuspended()) {
+            $this->fiber->resume();
+        }
+
+        if ($this->finished && $this->repeat) {
+            $this->start();
+        }
+
+        $profiler?->end();
     }
 
-    public function custom(callable $fn, float $duration): self
+    /**
+     * Seconds until an update changes anything, 0.0 while a track is playing
+     * and the time left while in wait(). INF once a non-repeating scheduler
+     * has finished. manual() steps can do anything and always count as busy.
+     */
+    public function nextUpdateIn(): float
     {
-        $this->animations[] = function () use ($fn, $duration) {
-            $elapsed = 0.0;
+        if (!$this->started) {
+            return 0.0;
+        }
 
-            while ($elapsed < $duration) {
-                $dt = $this->rl->GetFrameTime();
-                $elapsed += $dt;
-                $progress = min(1.0, $elapsed / $duration);
+        if ($this->finished) {
+            return $this->repeat ? 0.0 : INF;
+        }
 
-                $fn($this->target, $progress, $dt);
+        return $this->wakeAt === null ? 0.0 : max(0.0, $this->wakeAt - $this->clock->getTime());
+    }
 
-                Fiber::suspend();
-            }
-        };
-        return $this;
+    /**
+     * Clock time the scheduler sleeps until, null unless it is parked.
+     */
+    public function wakeAt(): ?float
+    {
+        return $this->wakeAt;
     }
 
-    public function parallel(array $schedulers): self
+    /**
+     * Whether the sequence has run to its end. Never true for a repeating
+     * scheduler that is kept updated.
+     */
+    public function isFinished(): bool
     {
-        $this->animations[] = static function () use ($schedulers) {
-            $schedulers = array_map(static fn($s) => clone $s, $schedulers);
+        return $this->finished;
+    }
 
-            foreach ($schedulers as $scheduler) {
-                $scheduler->start();
-            }
+    /**
+     * Flattens the sequence into a Timeline that can be evaluated at any time.
+     *
+     * Nested parallel() and then() schedulers are laid out on the same
+     * timeline. manual() steps and nested repeating schedulers have no fixed
+     * length and cannot be placed on it.
+     */
+    public function toTimeline(): Timeline
+    {
+        $timeline = new Timeline($this->clock, $this->repeat);
+        $this->layout($timeline, 0.0);
 
-            $allFinished = false;
-            while (!$allFinished) {
-                $allFinished = true;
-                foreach ($schedulers as $scheduler) {
-                    if ($scheduler->fiber->isTerminated()) {
-                        continue;
-                    }
+        return $timeline;
+    }
 
-                    $scheduler->fiber->resume();
-                    $allFinished = false;
-                }
-                if (!$allFinished) {
-                    Fiber::suspend();
+    private function layout(Timeline $timeline, float $offset): float
+    {
+        foreach ($this->animations as $animation) {
+            if ($animation instanceof Track) {
+                $timeline->add($offset, clone $animation);
+                $offset += $animation->duration();
+            } elseif ($animation instanceof Parallel) {
+                $end = $offset;
+                foreach ($animation->schedulers as $scheduler) {
+                    $end = max($end, $scheduler->layoutNested($timeline, $offset));
                 }
+                $offset = $end;
+            } elseif ($animation instanceof Scheduler) {
+                $offset = $animation->layoutNested($timeline, $offset);
+            } else {
+                throw new \LogicException('manual() steps cannot be placed on a timeline, they only run inside a Fiber.');
             }
-        };
-        return $this;
+        }
+
+        return $offset;
     }
 
-    public function then(Scheduler $scheduler): self
+    private function layoutNested(Timeline $timeline, float $offset): float
     {
-        $this->animations[] = static function () use ($scheduler) {
-            $newScheduler = clone $scheduler;
-            $newScheduler->start();
+        if ($this->repeat) {
+            throw new \LogicException('Repeating schedulers cannot be nested in a timeline.');
+        }
 
-            while (!$newScheduler->fiber->isTerminated()) {
-                $newScheduler->update();
-                Fiber::suspend();
-            }
-        };
-        return $this;
+        return $this->layout($timeline, $offset);
     }
 
-    public function start()
+    /**
+     * Body of the Fiber. Instead of returning at the end of the sequence it
+     * suspends, and start() resumes it for the next run, so repeating does
+     * not allocate a new Fiber every cycle.
+     */
+    private function loop(): void
     {
-        $this->fiber = new Fiber(function () {
-            foreach ($this->animations as $animation) {
-                $animation();
+        while (true) {
+            foreach ($this->animations as $step => $animation) {
+                $this->run($step, $animation);
             }
-        });
 
-        $this->fiber->start();
-        $this->started = true;
+            $this->finished = true;
+            Fiber::suspend();
+        }
     }
 
-    public function repeat(): self
+    private function run(int $step, Track|Parallel|Scheduler|callable $animation): void
     {
-        $this->repeat = true;
-        return $this;
+        if ($animation instanceof Track) {
+            $this->runTrack($animation);
+        } elseif ($animation instanceof Parallel) {
+            $this->runNested($step, $animation->schedulers, false);
+        } elseif ($animation instanceof Scheduler) {
+            $this->runNested($step, [$animation], true);
+        } else {
+            $animation();
+        }
     }
 
-    public function update()
+    private function runTrack(Track $track): void
     {
-        if (!$this->started) {
-            $this->start();
+        $duration = $track->duration();
+        $track->begin();
+
+        if ($duration <= 0.0) {
+            $track->apply(0.0);
+            return;
         }
 
-        if ($this->fiber->isSuspended()) {
-            $this->fiber->resume();
+        // Nothing to apply, sleep through the whole wait in one suspension
+        if ($track instanceof WaitTrack) {
+            $this->suspend($this->clock->getTime() + $duration);
+            return;
         }
 
-        if ($this->fiber->isTerminated() && $this->repeat) {
-            $this->start();
+        $elapsed = 0.0;
+
+        while ($elapsed < $duration) {
+            $elapsed += $this->clock->getFrameTime();
+            $track->apply($elapsed);
+
+            Fiber::suspend();
         }
     }
 
-    private function applyEasing(float $t): float
+    /**
+     * Runs the schedulers of a parallel() or then() step until they are all
+     * done, parked for as long as they all wait so the schedulers above do
+     * not resume this one either. The next step starts on the update after
+     * the last one finished.
+     *
+     * The schedulers are copied on the first run of the step, and the copies
+     * and their runtime are reused on every run after it.
+     *
+     * @param Scheduler[] $schedulers
+     * @param bool $repeat Whether a repeating scheduler keeps the step running, parallel() branches run once
+     */
+    private function runNested(int $step, array $schedulers, bool $repeat): void
     {
-        if ($this->easingFunc) {
-            return call_user_func($this->easingFunc, $t);
+        if (!isset($this->nested[$step])) {
+            $copies = [];
+            foreach ($schedulers as $scheduler) {
+                $copy = clone $scheduler;
+                $copy->repeat = $repeat && $scheduler->repeat;
+                $copies[] = $copy;
+            }
+
+            $this->nested[$step] = [new Runtime($this->clock), $copies];
+        }
+
+        [$runtime, $copies] = $this->nested[$step];
+
+        foreach ($copies as $copy) {
+            $copy->start();
+            $runtime->add($copy);
+        }
+
+        while (!$runtime->isEmpty()) {
+            $runtime->update();
+            $this->suspend($runtime->nextWakeAt());
         }
-        return $t;
+    }
+
+    /**
+     * Suspends the Fiber. With a wake time, update() does not resume it
+     * before the clock gets there and runtimes park it until then.
+     */
+    private function suspend(?float $wakeAt = null): void
+    {
+        $this->wakeAt = $wakeAt;
+        Fiber::suspend();
+        $this->wakeAt = null;
+    }
+
+    /**
+     * Resolves the easing of a new track, falling back to the scheduler's.
+     */
+    private function resolveEasing(EasingFunction|callable|null $easing): EasingFunction
+    {
+        return match (true) {
+            $easing === null => $this->easing,
+            $easing instanceof EasingFunction => $easing,
+            default => new CallbackEasing(Closure::fromCallable($easing)),
+        };
     }
 
     public function __clone()
     {
-        $this->fiber = new Fiber(function () {
-            foreach ($this->animations as $animation) {
-                $animation();
-            }
-        });
+        // Tracks keep per-run state, every copy needs its own.
+        $this->animations = array_map(
+            static fn($animation) => $animation instanceof Track ? clone $animation : $animation,
+            $this->animations,
+        );
+
+        // A copy starts out fresh, with a Fiber and nested copies of its own
+        $this->fiber = null;
+        $this->started = false;
+        $this->finished = false;
+        $this->wakeAt = null;
+        $this->nested = [];
     }
 }
@@ -0,0 +1,98 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Text;
+
+use Aashan\Phpanim\Raylib;
+use FFI\CData;
+
+/**
+ * A font whose glyphs are packed into a single atlas texture, loaded once.
+ *
+ * Text is drawn through the draw list, and every glyph becomes a quad
+ * sampling the same texture, so a screen full of labels stays in one raylib
+ * batch. Widths are measured once per string and size.
+ */
+final class Font
+{
+    // TEXTURE_FILTER_BILINEAR, keeps scaled glyphs smooth
+    private const FILTER_BILINEAR = 1;
+
+    // Measured widths kept before the cache starts over
+    private const MAX_WIDTHS = 4096;
+
+    public readonly CData $font;
+
+    private bool $loaded = false;
+
+    /** @var array<string, float> Widths by "size:text" */
+    private array $widths = [];
+
+    /**
+     * Without a path this is raylib's built-in font, the one DrawText() uses.
+     */
+    public function __construct(
+        private Raylib $rl,
+        ?string $path = null,
+        int $size = 32, // Glyph size in the atlas, draw at this size or below for crisp text
+    ) {
+        if ($path === null) {
+            $this->font = $rl->GetFontDefault();
+            return;
+        }
+
+        if (!is_file($path)) {
+            throw new \RuntimeException("Font not found at path: {$path}");
+        }
+
+        $this->font = $rl->LoadFontEx($path, $size, null, 0);
+
+        if (!$rl->IsFontValid($this->font)) {
+            throw new \RuntimeException("Unable to load the font {$path}.");
+        }
+
+        $rl->SetTextureFilter($this->font->texture, self::FILTER_BILINEAR);
+        $this->loaded = true;
+    }
+
+    /**
+     * Space between glyphs, the same DrawText() uses so both look alike.
+     */
+    public function spacing(float $fontSize): float
+    {
+        return floor(max($fontSize, 10.0) / 10.0);
+    }
+
+    public function measure(string $text, float $fontSize): float
+    {
+        $key = "{$fontSize}:{$text}";
+
+        if (isset($this->widths[$key])) {
+            return $this->widths[$key];
+        }
+
+        if (count($this->widths) >= self::MAX_WIDTHS) {
+            $this->widths = [];
+        }
+
+        return $this->widths[$key] = $this->rl->MeasureTextEx($this->font, $text, $fontSize, $this->spacing($fontSize))->x;
+    }
+
+    public function draw(string $text, float $posX, float $posY, float $fontSize, int $color): void
+    {
+        $this->rl->drawList()->textEx($this->font, $text, $posX, $posY, $fontSize, $this->spacing($fontSize), $color);
+    }
+
+    /**
+     * Releases the atlas texture. Flush the draw list first if it still has
+     * text in this font.
+     */
+    public function unload(): void
+    {
+        if ($this->loaded) {
+            $this->rl->UnloadFont($this->font);
+            $this->loaded = false;
+        }
+    }
+}
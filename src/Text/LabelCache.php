@@ -0,0 +1,62 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Text;
+
+/**
+ * Formatted number labels and their widths, by value.
+ *
+ * Axis labels repeat from frame to frame, so each one is formatted and
+ * measured once instead of every time the grid is drawn.
+ */
+final class LabelCache
+{
+    // Labels kept before the cache starts over
+    private const MAX_LABELS = 4096;
+
+    /** @var array<string, array{string, float}> */
+    private array $labels = [];
+
+    public function __construct(
+        public readonly Font $font,
+    ) {}
+
+    /**
+     * $value with at most $precision decimals and no trailing zeros, and its width.
+     *
+     * @return array{string, float} [label, width]
+     */
+    public function number(float $value, int $precision, float $fontSize): array
+    {
+        $key = "{$precision}:{$fontSize}:{$value}";
+
+        if (isset($this->labels[$key])) {
+            return $this->labels[$key];
+        }
+
+        if (count($this->labels) >= self::MAX_LABELS) {
+            $this->labels = [];
+        }
+
+        $label = self::format($value, $precision);
+
+        return $this->labels[$key] = [$label, $this->font->measure($label, $fontSize)];
+    }
+
+    public static function format(float $value, int $precision): string
+    {
+        if (abs($value) < 0.0001) {
+            return '0';
+        }
+
+        $formatted = number_format($value, $precision, '.', '');
+
+        if (str_contains($formatted, '.')) {
+            $formatted = rtrim($formatted, '0');
+            $formatted = rtrim($formatted, '.');
+        }
+
+        return $formatted;
+    }
+}
@@ -5,6 +5,7 @@ declare(strict_types=1);
 namespace Aashan\Phpanim\Traits;
 
 use Aashan\Phpanim\Types\Vec2;
+use Aashan\Phpanim\Types\Vec2Buffer;
 
 trait AnimatesVec2
 {
@@ -24,4 +25,19 @@ trait AnimatesVec2
             $vec->y = ($initialX * $sin) + ($initialY * $cos);
         });
     }
+
+    /**
+     * Rotates every point of the buffer around $origin (the coordinate
+     * origin without one) in a single tween.
+     */
+    public function rotateVec2Buffer(float $duration, Vec2Buffer $buffer, float $degrees, ?Vec2 $origin = null): static
+    {
+        $initial = $buffer->copy();
+        $originX = $origin?->x ?? 0.0;
+        $originY = $origin?->y ?? 0.0;
+
+        return $this->tween($duration, function (float $t) use ($buffer, $initial, $degrees, $originX, $originY) {
+            $buffer->rotate($degrees * $t, $originX, $originY, $initial);
+        });
+    }
 }
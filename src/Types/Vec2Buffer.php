@@ -0,0 +1,171 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Types;
+
+use Aashan\Phpanim\Raylib;
+use FFI;
+use FFI\CData;
+
+/**
+ * A packed array of 2D points, stored as a raylib Vector2[] so it can be
+ * passed straight to functions like DrawSplineLinear().
+ *
+ * Transforms work on the whole buffer at once: a rotation computes its
+ * sine and cosine once, not once per point, and with the draw shim built
+ * every operation is a single FFI call. Without the shim they fall back to
+ * PHP loops.
+ */
+final class Vec2Buffer
+{
+    public readonly CData $data;
+
+    public function __construct(
+        private Raylib $rl,
+        public readonly int $count,
+    ) {
+        if ($count <= 0) {
+            throw new \InvalidArgumentException('A buffer needs at least one point.');
+        }
+
+        $this->data = $rl->ffi->new("Vector2[{$count}]");
+    }
+
+    /**
+     * @param Vec2[] $points
+     */
+    public static function fromVec2s(Raylib $rl, array $points): self
+    {
+        $buffer = new self($rl, count($points));
+
+        foreach (array_values($points) as $i => $point) {
+            $buffer->set($i, $point->x, $point->y);
+        }
+
+        return $buffer;
+    }
+
+    public function get(int $i): Vec2
+    {
+        return new Vec2($this->data[$i]->x, $this->data[$i]->y);
+    }
+
+    public function set(int $i, float $x, float $y): void
+    {
+        $this->data[$i]->x = $x;
+        $this->data[$i]->y = $y;
+    }
+
+    public function copy(): self
+    {
+        $buffer = new self($this->rl, $this->count);
+        $buffer->copyFrom($this);
+
+        return $buffer;
+    }
+
+    public function copyFrom(Vec2Buffer $source): void
+    {
+        $this->assertSameCount($source);
+        FFI::memcpy($this->data, $source->data, FFI::sizeof($this->data));
+    }
+
+    /**
+     * Sets every point to (a * x + b * y + tx, c * x + d * y + ty), where
+     * (x, y) is the same point of $source, or of this buffer without one.
+     */
+    public function transform(float $a, float $b, float $c, float $d, float $tx, float $ty, ?Vec2Buffer $source = null): void
+    {
+        $source ??= $this;
+        $this->assertSameCount($source);
+
+        $shim = $this->rl->drawList()->shim();
+
+        if ($shim !== null) {
+            $shim->PhpanimTransform($this->floats($shim), $source->floats($shim), $this->count, $a, $b, $c, $d, $tx, $ty);
+            return;
+        }
+
+        $in = $source->data;
+        $out = $this->data;
+
+        for ($i = 0; $i < $this->count; $i++) {
+            $x = $in[$i]->x;
+            $y = $in[$i]->y;
+
+            $out[$i]->x = ($a * $x) + ($b * $y) + $tx;
+            $out[$i]->y = ($c * $x) + ($d * $y) + $ty;
+        }
+    }
+
+    /**
+     * Rotates every point counter-clockwise around ($originX, $originY).
+     */
+    public function rotate(float $degrees, float $originX = 0.0, float $originY = 0.0, ?Vec2Buffer $source = null): void
+    {
+        $radians = deg2rad($degrees);
+        $cos = cos($radians);
+        $sin = sin($radians);
+
+        $this->transform(
+            $cos,
+            -$sin,
+            $sin,
+            $cos,
+            $originX - ($cos * $originX) + ($sin * $originY),
+            $originY - ($sin * $originX) - ($cos * $originY),
+            $source,
+        );
+    }
+
+    public function translate(float $dx, float $dy, ?Vec2Buffer $source = null): void
+    {
+        $this->transform(1.0, 0.0, 0.0, 1.0, $dx, $dy, $source);
+    }
+
+    public function scale(float $sx, float $sy, ?Vec2Buffer $source = null): void
+    {
+        $this->transform($sx, 0.0, 0.0, $sy, 0.0, 0.0, $source);
+    }
+
+    /**
+     * Sets every point between the same points of $from and $to, at $t between 0 and 1.
+     */
+    public function lerp(Vec2Buffer $from, Vec2Buffer $to, float $t): void
+    {
+        $this->assertSameCount($from);
+        $this->assertSameCount($to);
+
+        $shim = $this->rl->drawList()->shim();
+
+        if ($shim !== null) {
+            $shim->PhpanimLerp($this->floats($shim), $from->floats($shim), $to->floats($shim), 2 * $this->count, $t);
+            return;
+        }
+
+        for ($i = 0; $i < $this->count; $i++) {
+            $this->data[$i]->x = $from->data[$i]->x + ($to->data[$i]->x - $from->data[$i]->x) * $t;
+            $this->data[$i]->y = $from->data[$i]->y + ($to->data[$i]->y - $from->data[$i]->y) * $t;
+        }
+    }
+
+    /**
+     * The points as interleaved floats, for the shim kernels.
+     */
+    private function floats(FFI $shim): CData
+    {
+        return $shim->cast('float *', FFI::addr($this->data[0]));
+    }
+
+    private function assertSameCount(Vec2Buffer $other): void
+    {
+        if ($other->count !== $this->count) {
+            throw new \InvalidArgumentException(sprintf(
+                'Expected a buffer of %d points, got %d.',
+                $this->count,
+                $other->count,
+            ));
+        }
+    }
+}
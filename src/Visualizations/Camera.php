@@ -0,0 +1,109 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Visualizations;
+
+use Aashan\Phpanim\Raylib;
+use Aashan\Phpanim\Types\Vec2;
+use FFI\CData;
+
+/**
+ * Pan and zoom shared by visualizations, the graph space counterpart of
+ * raylib's Camera2D.
+ *
+ * The graph point $target is shown at the screen position $offset, and
+ * $zoom is the number of pixels per graph unit. Graph Y points up, screen
+ * Y points down. All three can be tweened like any other property, e.g.
+ * tween('zoom', ...) or tween('target.x', ...).
+ *
+ * A zoom of zero or below shows nothing: grids and curves skip drawing,
+ * and toGraph() treats it as MIN_ZOOM. Zoom-in intros may start at 0.
+ */
+final class Camera
+{
+    // Zoom toGraph() divides by when the zoom is zero or negative
+    public const MIN_ZOOM = 1e-6;
+
+    public function __construct(
+        public Vec2 $target = new Vec2(), // Graph point shown at the offset
+        public Vec2 $offset = new Vec2(), // Screen position of the target
+        public float $zoom = 20.0, // Pixels per graph unit
+    ) {}
+
+    /**
+     * A camera showing the graph origin in the middle of the screen.
+     */
+    public static function centered(Raylib $rl, float $zoom = 20.0): self
+    {
+        return new self(new Vec2(), new Vec2($rl->GetScreenWidth() / 2, $rl->GetScreenHeight() / 2), $zoom);
+    }
+
+    /**
+     * Screen position of the graph origin.
+     */
+    public function origin(): Vec2
+    {
+        return new Vec2(
+            $this->offset->x - ($this->target->x * $this->zoom),
+            $this->offset->y + ($this->target->y * $this->zoom),
+        );
+    }
+
+    public function toScreen(float $x, float $y): Vec2
+    {
+        return new Vec2(
+            $this->offset->x + (($x - $this->target->x) * $this->zoom),
+            $this->offset->y - (($y - $this->target->y) * $this->zoom),
+        );
+    }
+
+    public function toGraph(float $screenX, float $screenY): Vec2
+    {
+        $zoom = max($this->zoom, self::MIN_ZOOM);
+
+        return new Vec2(
+            $this->target->x + (($screenX - $this->offset->x) / $zoom),
+            $this->target->y - (($screenY - $this->offset->y) / $zoom),
+        );
+    }
+
+    /**
+     * Whether anything can be drawn at the current zoom, false while it is
+     * zero, negative or NaN.
+     */
+    public function isVisible(): bool
+    {
+        return $this->zoom > 0.0;
+    }
+
+    /**
+     * Graph space rectangle covered by the screen, grown by $margin pixels
+     * on every side.
+     *
+     * @return array{float, float, float, float} [minX, minY, maxX, maxY]
+     */
+    public function visible(Raylib $rl, float $margin = 0.0): array
+    {
+        $min = $this->toGraph(-$margin, $rl->GetScreenHeight() + $margin);
+        $max = $this->toGraph($rl->GetScreenWidth() + $margin, -$margin);
+
+        return [$min->x, $min->y, $max->x, $max->y];
+    }
+
+    /**
+     * A raylib Camera2D for drawing directly in graph units between
+     * BeginMode2D() and EndMode2D(). raylib's Y axis points down, so draw
+     * at (x, -y).
+     */
+    public function struct(Raylib $rl): CData
+    {
+        $camera = $rl->struct('Camera2D', ['rotation' => 0.0, 'zoom' => $this->zoom]);
+        $camera->offset->x = $this->offset->x;
+        $camera->offset->y = $this->offset->y;
+        $camera->target->x = $this->target->x;
+        $camera->target->y = -$this->target->y;
+
+        return $camera;
+    }
+}
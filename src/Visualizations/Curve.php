@@ -6,9 +6,54 @@ namespace Aashan\Phpanim\Visualizations;
 use Aashan\Phpanim\Raylib;
 use Aashan\Phpanim\Types\Vec2;
 use Closure;
+use FFI;
+use FFI\CData;
 
 class Curve
 {
+    // Deepest subdivision of a lattice interval when sampling adaptively
+    private const MAX_DEPTH = 12;
+
+    // Function samples by lattice index, x = index * step
+    private array $samples = [];
+    private float $step = 0.0;
+    private ?Closure $sampledFn = null;
+
+    // Pixels per unit of the current frame, unitSize or the camera's zoom
+    private float $scale = 0.0;
+
+    // Screen mapping the vertex buffer was built with
+    private array $mapping = [];
+    private bool $built = false;
+
+    // Adaptive refinement points by lattice interval, null marks a discontinuity
+    private array $refined = [];
+    private array $refinement = [];
+    private int $budget = 0;
+    private bool $incomplete = false;
+
+    // Lattice range currently in the vertex buffer
+    private int $from = 0;
+    private int $to = -1;
+    private int $used = 1;
+
+    // Persistent vertex buffer, slot 0 is reserved for the exact min.x point
+    // and the slot after the last used one for the exact max.x point
+    private ?CData $vertices = null;
+    private int $capacity = 0;
+
+    // Draw list generation the last render recorded its strips in, see DrawList::generation()
+    private ?int $recordedIn = null;
+
+    // Runs of visible vertices as [first slot, end slot)
+    private array $strips = [];
+    private bool $firstVisible = false;
+    private bool $lastVisible = false;
+
+    // Samples at the exact (off-lattice) ends of the range
+    private array $head = [NAN, NAN];
+    private array $tail = [NAN, NAN];
+
     public function __construct(
         public Vec2 $origin, // Screen coordinate origin
         public Vec2 $min, // Minimum XY bounds (bottom-left corner in graph space)
@@ -18,56 +63,339 @@ class Curve
         public float $thickness = 2.0,
         public float $unitSize = 20.0,
         public int $segments = 100,
+        public ?float $tolerance = null, // Max screen-space error in pixels, enables adaptive sampling
+        public int $maxSamples = 4096, // Max adaptive refinement evaluations per frame
+        public ?Camera $camera = null, // Replaces origin and unitSize
+        public bool $cache = true, // False re-samples every frame, for functions reading state that changes
     ) {}
 
+    /**
+     * Drops the cached samples, so the next render() evaluates the function
+     * again. Call it after changing state the function reads, replacing
+     * $fn does this on its own.
+     */
+    public function invalidate(): void
+    {
+        $this->sampledFn = null;
+    }
+
     public function render(Raylib $rl): void
     {
-        // Extract bounds
-        $minX = $this->min->x;
-        $maxX = $this->max->x;
-        $minY = $this->min->y;
-        $maxY = $this->max->y;
+        // Commands of the last render point into the vertex buffer, draw them before it is rewritten
+        $list = $rl->drawList();
+        if ($this->recordedIn === $list->generation() && count($list) > 0) {
+            $list->flush();
+        }
+
+        if ($this->camera !== null) {
+            $origin = $this->camera->origin();
+            [$originX, $originY, $this->scale] = [$origin->x, $origin->y, $this->camera->zoom];
+        } else {
+            [$originX, $originY, $this->scale] = [$this->origin->x, $this->origin->y, $this->unitSize];
+        }
+
+        // A zoom or unit size of zero, e.g. the first frame of a zoom-in, draws nothing
+        if (!($this->scale > 0.0)) {
+            return;
+        }
+
+        // Only the part of the domain on screen is sampled, so the number of
+        // samples stays the same at any zoom level. The margin keeps the
+        // ends of thick lines from showing at the screen edges.
+        $margin = ($this->thickness + 2) / $this->scale;
+        $minX = max($this->min->x, (-$originX / $this->scale) - $margin);
+        $maxX = min($this->max->x, (($rl->GetScreenWidth() - $originX) / $this->scale) + $margin);
+
+        if ($maxX <= $minX || $this->segments <= 0) {
+            return; // Nothing to draw yet, or nothing on screen
+        }
+
+        // Samples live on a power-of-two lattice, so extending the bounds only
+        // evaluates the newly exposed part and changing the density reuses
+        // every other (or every) existing sample.
+        $step = 2 ** floor(log(($maxX - $minX) / $this->segments, 2));
+
+        if (!$this->cache || $this->fn !== $this->sampledFn) {
+            $this->samples = [];
+            $this->refined = [];
+            $this->head = $this->tail = [NAN, NAN];
+            $this->sampledFn = $this->fn;
+            $this->built = false;
+        }
+
+        if ($step !== $this->step) {
+            $this->rescale($step);
+            $this->refined = [];
+            $this->built = false;
+        }
+
+        // Refinement depends on the screen-space error, so on the scale too
+        $refinement = [$this->scale, $this->tolerance];
+        if ($refinement !== $this->refinement) {
+            $this->refinement = $refinement;
+            $this->refined = [];
+            $this->built = false;
+        }
+
+        // Intervals cut short by the budget last frame get another go
+        if ($this->incomplete) {
+            $this->incomplete = false;
+            $this->built = false;
+        }
+
+        $this->budget = $this->maxSamples;
+
+        $mapping = [$originX, $originY, $this->scale, $this->min->y, $this->max->y];
+        if ($mapping !== $this->mapping) {
+            $this->mapping = $mapping;
+            $this->built = false;
+        }
+
+        $from = (int) ceil($minX / $step);
+        $to = (int) floor($maxX / $step);
+
+        if (!$this->built || $from !== $this->from || $to < $this->to) {
+            $this->rebuild($rl, $from, $to);
+        } elseif ($to > $this->to) {
+            $this->extend($rl, $to);
+        }
+
+        $this->draw($rl, $minX, $maxX);
+    }
+
+    private function rescale(float $step): void
+    {
+        if ($this->step > 0.0 && $this->samples !== []) {
+            $remapped = [];
+
+            if ($step > $this->step) {
+                $ratio = (int) round($step / $this->step);
+                foreach ($this->samples as $k => $y) {
+                    if ($k % $ratio === 0) {
+                        $remapped[intdiv($k, $ratio)] = $y;
+                    }
+                }
+            } else {
+                $ratio = (int) round($this->step / $step);
+                foreach ($this->samples as $k => $y) {
+                    $remapped[$k * $ratio] = $y;
+                }
+            }
+
+            $this->samples = $remapped;
+        }
+
+        $this->step = $step;
+    }
+
+    private function rebuild(Raylib $rl, int $from, int $to): void
+    {
+        // Drop samples far outside the visible range once the cache grows large
+        if (count($this->samples) > 8 * ($this->segments + 1)) {
+            $this->samples = array_filter(
+                $this->samples,
+                static fn(int $k) => $k >= $from && $k <= $to,
+                ARRAY_FILTER_USE_KEY,
+            );
+            $this->refined = array_filter(
+                $this->refined,
+                static fn(int $k) => $k >= $from && $k < $to,
+                ARRAY_FILTER_USE_KEY,
+            );
+        }
+
+        $this->from = $from;
+        $this->to = $from - 1;
+        $this->used = 1;
+        $this->strips = [];
+        $this->firstVisible = false;
+        $this->lastVisible = false;
+        $this->built = true;
+
+        $this->extend($rl, $to);
+    }
+
+    private function extend(Raylib $rl, int $to): void
+    {
+        [$originX, $originY, $unitSize, $minY, $maxY] = $this->mapping;
+        $fn = $this->fn;
+        $step = $this->step;
+        $adaptive = $this->tolerance !== null;
+
+        for ($k = $this->to + 1; $k <= $to; $k++) {
+            $graphX = $k * $step;
+            $graphY = $this->samples[$k] ??= $fn($graphX);
+
+            // Refined points between the previous lattice point and this one
+            $run = $adaptive && $k > $this->from ? $this->refine($k - 1) : [];
+            $run[] = [$graphX, $graphY];
+
+            $this->reserve($rl, $this->used + count($run) + 1);
+            $vertices = $this->vertices;
+
+            foreach ($run as $point) {
+                // Points outside the Y bounds and discontinuities end the current strip
+                if ($point === null || !($point[1] >= $minY && $point[1] <= $maxY)) {
+                    $this->lastVisible = false;
+                    continue;
+                }
+
+                $slot = $this->used++;
+                $vertices[$slot]->x = $originX + ($point[0] * $unitSize);
+                $vertices[$slot]->y = $originY - ($point[1] * $unitSize);
+
+                if ($this->lastVisible) {
+                    $this->strips[count($this->strips) - 1][1] = $slot + 1;
+                } else {
+                    $this->strips[] = [$slot, $slot + 1];
+                }
+
+                $this->lastVisible = true;
+            }
+
+            if ($k === $this->from) {
+                $this->firstVisible = $this->lastVisible;
+            }
+        }
+
+        $this->to = $to;
+    }
+
+    /**
+     * Points to insert inside the lattice interval [k, k + 1] so the curve
+     * stays within the pixel tolerance of the function.
+     */
+    private function refine(int $k): array
+    {
+        if (isset($this->refined[$k])) {
+            return $this->refined[$k];
+        }
+
+        $points = [];
+        $complete = $this->subdivide(
+            $k * $this->step,
+            $this->samples[$k],
+            ($k + 1) * $this->step,
+            $this->samples[$k + 1],
+            0,
+            $points,
+        );
+
+        if ($complete) {
+            $this->refined[$k] = $points;
+        } else {
+            $this->incomplete = true;
+        }
+
+        return $points;
+    }
+
+    /**
+     * Recursively bisects an interval while its midpoint deviates from the
+     * chord by more than the tolerance. Returns false when the per-frame
+     * budget ran out before the interval was fully refined.
+     */
+    private function subdivide(float $x0, float $y0, float $x1, float $y1, int $depth, array &$points): bool
+    {
+        if ($depth >= self::MAX_DEPTH) {
+            // Still not converging at the finest level: a jump, not a steep slope
+            if (!(abs($y1 - $y0) * $this->scale <= max(16.0 * $this->tolerance, 8.0))) {
+                $points[] = null;
+            }
+            return true;
+        }
 
-        $step = ($maxX - $minX) / $this->segments;
+        if ($this->budget <= 0) {
+            return false;
+        }
+
+        $this->budget--;
 
-        // Collect valid points within bounds
-        $validPoints = [];
+        $xm = ($x0 + $x1) / 2;
+        $ym = ($this->fn)($xm);
 
-        for ($i = 0; $i <= $this->segments; $i++) {
-            // Calculate graph x coordinate
-            $graphX = $minX + ($i * $step);
+        // Poles and undefined points break the curve
+        if (!is_finite($ym)) {
+            $points[] = null;
+            return true;
+        }
 
-            // Evaluate function at this x
-            $graphY = ($this->fn)($graphX);
+        if (abs((($y0 + $y1) / 2) - $ym) * $this->scale <= $this->tolerance) {
+            return true;
+        }
+
+        $complete = $this->subdivide($x0, $y0, $xm, $ym, $depth + 1, $points);
+        $points[] = [$xm, $ym];
+
+        return $this->subdivide($xm, $ym, $x1, $y1, $depth + 1, $points) && $complete;
+    }
+
+    private function draw(Raylib $rl, float $minX, float $maxX): void
+    {
+        [$originX, $originY, $unitSize, $minY, $maxY] = $this->mapping;
+        $vertices = $this->vertices;
+        $strips = $this->strips;
 
-            // Clip to Y bounds
-            if ($graphY < $minY || $graphY > $maxY) {
-                // Point is outside bounds, skip it
-                continue;
+        // Extend the first strip to the exact min.x
+        if ($this->from * $this->step > $minX) {
+            if ($this->head[0] !== $minX) {
+                $this->head = [$minX, ($this->fn)($minX)];
             }
 
-            // Convert graph coordinates to screen coordinates
-            $screenX = $this->origin->x + ($graphX * $this->unitSize);
-            $screenY = $this->origin->y - ($graphY * $this->unitSize);
+            $graphY = $this->head[1];
+            if ($graphY >= $minY && $graphY <= $maxY && $this->firstVisible) {
+                $vertices[0]->x = $originX + ($minX * $unitSize);
+                $vertices[0]->y = $originY - ($graphY * $unitSize);
+                $strips[0][0] = 0;
+            }
+        }
+
+        // Extend the last strip to the exact max.x
+        if ($this->to * $this->step < $maxX) {
+            if ($this->tail[0] !== $maxX) {
+                $this->tail = [$maxX, ($this->fn)($maxX)];
+            }
+
+            $graphY = $this->tail[1];
+            if ($graphY >= $minY && $graphY <= $maxY && $this->lastVisible) {
+                $slot = $this->used;
+                $last = count($strips) - 1;
+                $vertices[$slot]->x = $originX + ($maxX * $unitSize);
+                $vertices[$slot]->y = $originY - ($graphY * $unitSize);
+                $strips[$last][1] = $slot + 1;
+            }
+        }
+
+        $list = $rl->drawList();
+
+        foreach ($strips as [$start, $end]) {
+            $pointCount = $end - $start;
 
-            $validPoints[] = ['x' => $screenX, 'y' => $screenY];
+            // Catmull-Rom needs at least four points, shorter strips are drawn straight
+            if ($pointCount >= 4) {
+                $list->splineCatmullRom(FFI::addr($vertices[$start]), $pointCount, $this->thickness, $this->color, $vertices);
+            } elseif ($pointCount >= 2) {
+                $list->splineLinear(FFI::addr($vertices[$start]), $pointCount, $this->thickness, $this->color, $vertices);
+            }
         }
 
-        $pointCount = count($validPoints);
+        $this->recordedIn = $list->generation();
+    }
 
-        if ($pointCount < 2) {
-            return; // Not enough points to draw a curve
+    private function reserve(Raylib $rl, int $needed): void
+    {
+        if ($needed <= $this->capacity) {
+            return;
         }
 
-        // Create FFI Vector2 array with only valid points
-        $points = $rl->ffi->new("Vector2[{$pointCount}]");
+        $capacity = max($needed, $this->capacity * 2, 64);
+        $vertices = $rl->ffi->new("Vector2[{$capacity}]");
 
-        foreach ($validPoints as $i => $point) {
-            $points[$i]->x = $point['x'];
-            $points[$i]->y = $point['y'];
+        if ($this->vertices !== null) {
+            FFI::memcpy($vertices, $this->vertices, FFI::sizeof($this->vertices));
         }
 
-        // Draw the curve
-        $rl->DrawSplineCatmullRom($points, $pointCount, $this->thickness, $rl->GetColor($this->color));
+        $this->vertices = $vertices;
+        $this->capacity = $capacity;
     }
 }
@@ -0,0 +1,161 @@
+<?php
+
+declare(strict_types=1);
+
+namespace Aashan\Phpanim\Visualizations;
+
+use Aashan\Phpanim\Raylib;
+use Aashan\Phpanim\Types\Vec2;
+use Closure;
+use FFI;
+use FFI\CData;
+
+/**
+ * Draws large numbers of points (100k and more) as small squares.
+ *
+ * Positions, velocities and colors live in separate packed FFI arrays
+ * instead of one Vec2 per point, and are updated with bulk kernels from
+ * the draw shim: moving every point by its velocity or morphing the whole
+ * set into another one is a single FFI call. The points are drawn with one
+ * draw list command, which raylib turns into a handful of GPU draw calls.
+ *
+ * Without the shim the kernels and the drawing fall back to PHP loops,
+ * which work but only keep up with a few thousand points.
+ */
+final class PointCloud
+{
+    public readonly CData $x;
+    public readonly CData $y;
+    public readonly CData $vx;
+    public readonly CData $vy;
+
+    // Colors as 0xRRGGBBAA
+    public readonly CData $colors;
+
+    public function __construct(
+        private Raylib $rl,
+        public readonly int $count,
+        public Vec2 $origin = new Vec2(), // Screen coordinate origin
+        public float $unitSize = 20.0,
+        public float $size = 2.0, // Side of a point in pixels
+        int $color = 0x000000FF,
+    ) {
+        if ($count <= 0) {
+            throw new \InvalidArgumentException('A point cloud needs at least one point.');
+        }
+
+        $this->x = $rl->ffi->new("float[{$count}]");
+        $this->y = $rl->ffi->new("float[{$count}]");
+        $this->vx = $rl->ffi->new("float[{$count}]");
+        $this->vy = $rl->ffi->new("float[{$count}]");
+        $this->colors = $rl->ffi->new("unsigned int[{$count}]");
+
+        for ($i = 0; $i < $count; $i++) {
+            $this->colors[$i] = $color;
+        }
+    }
+
+    public function set(int $i, float $x, float $y, ?int $color = null): void
+    {
+        $this->x[$i] = $x;
+        $this->y[$i] = $y;
+
+        if ($color !== null) {
+            $this->colors[$i] = $color;
+        }
+    }
+
+    public function setVelocity(int $i, float $vx, float $vy): void
+    {
+        $this->vx[$i] = $vx;
+        $this->vy[$i] = $vy;
+    }
+
+    /**
+     * Sets every point from $fn(int $i), which returns [x, y] or [x, y, color].
+     */
+    public function fill(Closure $fn): void
+    {
+        for ($i = 0; $i < $this->count; $i++) {
+            $point = $fn($i);
+            $this->set($i, $point[0], $point[1], $point[2] ?? null);
+        }
+    }
+
+    /**
+     * Moves every point by its velocity over $dt seconds.
+     */
+    public function step(float $dt): void
+    {
+        $shim = $this->rl->drawList()->shim();
+
+        if ($shim !== null) {
+            $shim->PhpanimIntegrate($this->x, $this->y, $this->vx, $this->vy, $this->count, $dt);
+            return;
+        }
+
+        for ($i = 0; $i < $this->count; $i++) {
+            $this->x[$i] += $this->vx[$i] * $dt;
+            $this->y[$i] += $this->vy[$i] * $dt;
+        }
+    }
+
+    /**
+     * Sets the positions to the interpolation between two position sets of
+     * the same size, at $t between 0 and 1.
+     */
+    public function lerp(CData $fromX, CData $fromY, CData $toX, CData $toY, float $t): void
+    {
+        $shim = $this->rl->drawList()->shim();
+
+        if ($shim !== null) {
+            $shim->PhpanimLerp($this->x, $fromX, $toX, $this->count, $t);
+            $shim->PhpanimLerp($this->y, $fromY, $toY, $this->count, $t);
+            return;
+        }
+
+        for ($i = 0; $i < $this->count; $i++) {
+            $this->x[$i] = $fromX[$i] + ($toX[$i] - $fromX[$i]) * $t;
+            $this->y[$i] = $fromY[$i] + ($toY[$i] - $fromY[$i]) * $t;
+        }
+    }
+
+    /**
+     * Copies of the current positions.
+     *
+     * @return array{CData, CData} [x, y]
+     */
+    public function snapshot(): array
+    {
+        $x = $this->rl->ffi->new("float[{$this->count}]");
+        $y = $this->rl->ffi->new("float[{$this->count}]");
+
+        FFI::memcpy($x, $this->x, FFI::sizeof($x));
+        FFI::memcpy($y, $this->y, FFI::sizeof($y));
+
+        return [$x, $y];
+    }
+
+    /**
+     * Puts back positions taken with snapshot().
+     */
+    public function restore(CData $x, CData $y): void
+    {
+        FFI::memcpy($this->x, $x, FFI::sizeof($this->x));
+        FFI::memcpy($this->y, $y, FFI::sizeof($this->y));
+    }
+
+    public function render(): void
+    {
+        $this->rl->drawList()->points(
+            $this->x,
+            $this->y,
+            $this->colors,
+            $this->count,
+            $this->size,
+            $this->origin->x,
+            $this->origin->y,
+            $this->unitSize,
+        );
+    }
+}
@@ -4,10 +4,23 @@ declare(strict_types=1);
 namespace Aashan\Phpanim\Visualizations;
 
 use Aashan\Phpanim\Raylib;
+use Aashan\Phpanim\Text\Font;
+use Aashan\Phpanim\Text\LabelCache;
 use Aashan\Phpanim\Types\Vec2;
+use FFI\CData;
 
 class XYGrid
 {
+    // Offscreen copy of the grid and the parameters it was drawn with
+    private ?CData $cache = null;
+    private array $cacheKey = [];
+    private ?CData $source = null;
+    private ?CData $position = null;
+    private ?CData $tint = null;
+
+    private ?Font $defaultFont = null;
+    private ?LabelCache $labels = null;
+
     public function __construct(
         public Vec2 $origin,
         public float $spacing = 20.0,
@@ -22,200 +35,226 @@ class XYGrid
         public bool $showTicks = true,
         public float $tickSize = 5.0,
         public int $labelPrecision = 0,
+        public ?Camera $camera = null, // Replaces origin and unitSize, spacing becomes the minimum pixel distance between lines
+        public ?Font $font = null, // Label font, raylib's built-in font without one
     ) {}
 
     public function render(Raylib $rl): void
     {
+        // A zoom, unit size or spacing of zero, e.g. the first frame of a zoom-in, draws nothing
+        if (!(($this->camera?->zoom ?? $this->unitSize) > 0.0) || !($this->spacing > 0.0)) {
+            return;
+        }
+
         $screenWidth = $rl->GetScreenWidth();
         $screenHeight = $rl->GetScreenHeight();
-        $gridColor = $rl->GetColor($this->gridColor);
-        $majorGridColor = $rl->GetColor($this->majorGridColor);
-        $axisColor = $rl->GetColor($this->axisColor);
-        $labelColor = $rl->GetColor($this->labelColor);
-
-        $gridIndex = 0;
-
-        // Draw vertical grid lines (X-axis grid)
-        // Right side from origin
-        $gridIndex = 0;
-        for ($x = $this->origin->x; $x < $screenWidth; $x += $this->spacing) {
-            $isMajor = ($gridIndex % $this->labelInterval) === 0;
-            $lineColor = $isMajor ? $majorGridColor : $gridColor;
-
-            if ($x != $this->origin->x) {
-                $rl->DrawLine((int) $x, 0, (int) $x, $screenHeight, $lineColor);
-
-                // Draw tick and label only at major intervals
-                if ($isMajor) {
-                    if ($this->showTicks) {
-                        $rl->DrawLine(
-                            (int) $x,
-                            (int) ($this->origin->y - $this->tickSize),
-                            (int) $x,
-                            (int) ($this->origin->y + $this->tickSize),
-                            $axisColor,
-                        );
-                    }
-
-                    if ($this->showLabels) {
-                        $graphValue = ($x - $this->origin->x) / $this->unitSize;
-                        $label = $this->formatLabel($graphValue);
-                        $labelWidth = $rl->MeasureText($label, $this->fontSize);
-                        $rl->DrawText(
-                            $label,
-                            (int) ($x - ($labelWidth / 2)),
-                            (int) ($this->origin->y + $this->tickSize + 3),
-                            $this->fontSize,
-                            $labelColor,
-                        );
-                    }
-                }
-            }
-            $gridIndex++;
+
+        $key = [
+            ...$this->layout(), $this->labelInterval,
+            $this->gridColor, $this->majorGridColor, $this->axisColor, $this->labelColor, $this->fontSize,
+            $this->showLabels, $this->showTicks, $this->tickSize, $this->labelPrecision,
+            $this->font, $screenWidth, $screenHeight,
+        ];
+
+        // The grid rarely changes, so it is rasterized once into a render
+        // texture and only redrawn when one of its parameters changes.
+        if ($key !== $this->cacheKey) {
+            $this->rasterize($rl, $screenWidth, $screenHeight);
+            $this->cacheKey = $key;
         }
 
-        // Left side from origin
-        $gridIndex = 0;
-        for ($x = $this->origin->x - $this->spacing; $x > 0; $x -= $this->spacing) {
-            $gridIndex++;
-            $isMajor = ($gridIndex % $this->labelInterval) === 0;
-            $lineColor = $isMajor ? $majorGridColor : $gridColor;
-
-            $rl->DrawLine((int) $x, 0, (int) $x, $screenHeight, $lineColor);
-
-            if ($isMajor) {
-                if ($this->showTicks) {
-                    $rl->DrawLine(
-                        (int) $x,
-                        (int) ($this->origin->y - $this->tickSize),
-                        (int) $x,
-                        (int) ($this->origin->y + $this->tickSize),
-                        $axisColor,
-                    );
-                }
-
-                if ($this->showLabels) {
-                    $graphValue = ($x - $this->origin->x) / $this->unitSize;
-                    $label = $this->formatLabel($graphValue);
-                    $labelWidth = $rl->MeasureText($label, $this->fontSize);
-                    $rl->DrawText(
-                        $label,
-                        (int) ($x - ($labelWidth / 2)),
-                        (int) ($this->origin->y + $this->tickSize + 3),
-                        $this->fontSize,
-                        $labelColor,
-                    );
-                }
-            }
+        // Keep anything batched before the grid underneath it
+        $rl->drawList()->flush();
+        $rl->DrawTextureRec($this->cache->texture, $this->source, $this->position, $this->tint);
+    }
+
+    /**
+     * Releases the cached render texture.
+     */
+    public function unload(Raylib $rl): void
+    {
+        if ($this->cache !== null) {
+            $rl->UnloadRenderTexture($this->cache);
+            $this->cache = null;
+            $this->cacheKey = [];
         }
+    }
+
+    private function rasterize(Raylib $rl, int $screenWidth, int $screenHeight): void
+    {
+        if ($this->cache === null
+            || $this->cache->texture->width !== $screenWidth
+            || $this->cache->texture->height !== $screenHeight
+        ) {
+            $this->unload($rl);
+            $this->cache = $rl->LoadRenderTexture($screenWidth, $screenHeight);
+
+            // Render textures are stored upside down, flip them when drawing
+            $this->source = $rl->struct('Rectangle', [
+                'x' => 0,
+                'y' => 0,
+                'width' => $screenWidth,
+                'height' => -$screenHeight,
+            ]);
+            $this->position = $rl->constant('Vector2', ['x' => 0, 'y' => 0]);
+            $this->tint = $rl->color(0xFFFFFFFF);
+        }
+
+        $rl->pushRenderTarget($this->cache);
+        $rl->ClearBackground($rl->color(0x00000000));
+        $this->draw($rl, $screenWidth, $screenHeight);
+        $rl->popRenderTarget();
+    }
+
+    private function draw(Raylib $rl, int $screenWidth, int $screenHeight): void
+    {
+        // Batched, popping the render target executes the whole grid at once
+        $list = $rl->drawList();
+
+        [$originX, $originY, $unitSize, $spacing] = $this->layout();
+        $interval = max(1, $this->labelInterval);
+        $precision = $this->precision($spacing * $interval / $unitSize);
+
+        $font = $this->font ?? ($this->defaultFont ??= new Font($rl));
+        if ($this->labels?->font !== $font) {
+            $this->labels = new LabelCache($font);
+        }
+
+        $gridColor = $this->gridColor;
+        $majorGridColor = $this->majorGridColor;
+        $axisColor = $this->axisColor;
+        $labelColor = $this->labelColor;
+
+        // Keep the labels on screen when an axis is scrolled out of view
+        $labelY = min(max($originY, 0.0), $screenHeight - $this->fontSize - $this->tickSize - 3);
+        $labelX = min(max($originX, $this->tickSize + 3), (float) $screenWidth);
 
-        // Draw horizontal grid lines (Y-axis grid)
-        // Below origin
-        $gridIndex = 0;
-        for ($y = $this->origin->y; $y < $screenHeight; $y += $this->spacing) {
-            $isMajor = ($gridIndex % $this->labelInterval) === 0;
-            $lineColor = $isMajor ? $majorGridColor : $gridColor;
-
-            if ($y != $this->origin->y) {
-                $rl->DrawLine(0, (int) $y, $screenWidth, (int) $y, $lineColor);
-
-                if ($isMajor) {
-                    if ($this->showTicks) {
-                        $rl->DrawLine(
-                            (int) ($this->origin->x - $this->tickSize),
-                            (int) $y,
-                            (int) ($this->origin->x + $this->tickSize),
-                            (int) $y,
-                            $axisColor,
-                        );
-                    }
-
-                    if ($this->showLabels) {
-                        $graphValue = -($y - $this->origin->y) / $this->unitSize;
-                        $label = $this->formatLabel($graphValue);
-                        $labelWidth = $rl->MeasureText($label, $this->fontSize);
-                        $rl->DrawText(
-                            $label,
-                            (int) ($this->origin->x - $labelWidth - $this->tickSize - 3),
-                            (int) ($y - ($this->fontSize / 2)),
-                            $this->fontSize,
-                            $labelColor,
-                        );
-                    }
-                }
+        // Vertical grid lines, only the ones on screen however far away the origin is
+        $last = (int) floor(($screenWidth - $originX) / $spacing);
+        for ($k = (int) ceil(-$originX / $spacing); $k <= $last; $k++) {
+            if ($k === 0) {
+                continue;
+            }
+
+            $x = $originX + ($k * $spacing);
+            $isMajor = ($k % $interval) === 0;
+
+            $list->line((int) $x, 0, (int) $x, $screenHeight, $isMajor ? $majorGridColor : $gridColor);
+
+            // Draw tick and label only at major intervals
+            if (!$isMajor) {
+                continue;
+            }
+
+            if ($this->showTicks) {
+                $list->line((int) $x, (int) ($originY - $this->tickSize), (int) $x, (int) ($originY + $this->tickSize), $axisColor);
+            }
+
+            if ($this->showLabels) {
+                [$label, $labelWidth] = $this->labels->number($k * $spacing / $unitSize, $precision, $this->fontSize);
+                $font->draw(
+                    $label,
+                    (int) ($x - ($labelWidth / 2)),
+                    (int) ($labelY + $this->tickSize + 3),
+                    $this->fontSize,
+                    $labelColor,
+                );
             }
-            $gridIndex++;
         }
 
-        // Above origin
-        $gridIndex = 0;
-        for ($y = $this->origin->y - $this->spacing; $y > 0; $y -= $this->spacing) {
-            $gridIndex++;
-            $isMajor = ($gridIndex % $this->labelInterval) === 0;
-            $lineColor = $isMajor ? $majorGridColor : $gridColor;
-
-            $rl->DrawLine(0, (int) $y, $screenWidth, (int) $y, $lineColor);
-
-            if ($isMajor) {
-                if ($this->showTicks) {
-                    $rl->DrawLine(
-                        (int) ($this->origin->x - $this->tickSize),
-                        (int) $y,
-                        (int) ($this->origin->x + $this->tickSize),
-                        (int) $y,
-                        $axisColor,
-                    );
-                }
-
-                if ($this->showLabels) {
-                    $graphValue = -($y - $this->origin->y) / $this->unitSize;
-                    $label = $this->formatLabel($graphValue);
-                    $labelWidth = $rl->MeasureText($label, $this->fontSize);
-                    $rl->DrawText(
-                        $label,
-                        (int) ($this->origin->x - $labelWidth - $this->tickSize - 3),
-                        (int) ($y - ($this->fontSize / 2)),
-                        $this->fontSize,
-                        $labelColor,
-                    );
-                }
+        // Horizontal grid lines
+        $last = (int) floor(($screenHeight - $originY) / $spacing);
+        for ($k = (int) ceil(-$originY / $spacing); $k <= $last; $k++) {
+            if ($k === 0) {
+                continue;
+            }
+
+            $y = $originY + ($k * $spacing);
+            $isMajor = ($k % $interval) === 0;
+
+            $list->line(0, (int) $y, $screenWidth, (int) $y, $isMajor ? $majorGridColor : $gridColor);
+
+            if (!$isMajor) {
+                continue;
+            }
+
+            if ($this->showTicks) {
+                $list->line((int) ($originX - $this->tickSize), (int) $y, (int) ($originX + $this->tickSize), (int) $y, $axisColor);
+            }
+
+            if ($this->showLabels) {
+                [$label, $labelWidth] = $this->labels->number(-$k * $spacing / $unitSize, $precision, $this->fontSize);
+                $font->draw(
+                    $label,
+                    (int) max($labelX - $labelWidth - $this->tickSize - 3, 0),
+                    (int) ($y - ($this->fontSize / 2)),
+                    $this->fontSize,
+                    $labelColor,
+                );
             }
         }
 
         // Draw origin label
-        if ($this->showLabels) {
-            $rl->DrawText(
+        if ($this->showLabels && $originX >= 0 && $originX <= $screenWidth && $originY >= 0 && $originY <= $screenHeight) {
+            $font->draw(
                 '0',
-                (int) ($this->origin->x + $this->tickSize + 3),
-                (int) ($this->origin->y + $this->tickSize + 3),
+                (int) ($originX + $this->tickSize + 3),
+                (int) ($originY + $this->tickSize + 3),
                 $this->fontSize,
                 $labelColor,
             );
         }
 
         // Draw axes (on top of grid)
-        $xAxisStart = $rl->struct('Vector2', ['x' => 0, 'y' => $this->origin->y]);
-        $xAxisEnd = $rl->struct('Vector2', ['x' => $screenWidth, 'y' => $this->origin->y]);
-        $yAxisStart = $rl->struct('Vector2', ['x' => $this->origin->x, 'y' => 0]);
-        $yAxisEnd = $rl->struct('Vector2', ['x' => $this->origin->x, 'y' => $screenHeight]);
-
-        $rl->DrawLineEx($xAxisStart, $xAxisEnd, 2.0, $axisColor);
-        $rl->DrawLineEx($yAxisStart, $yAxisEnd, 2.0, $axisColor);
+        $list->lineEx(0, $originY, $screenWidth, $originY, 2.0, $axisColor);
+        $list->lineEx($originX, 0, $originX, $screenHeight, 2.0, $axisColor);
     }
 
-    private function formatLabel(float $value): string
+    /**
+     * Screen position of the origin, pixels per unit and pixels between
+     * grid lines.
+     *
+     * With a camera the grid step is the smallest 1, 2 or 5 times a power of
+     * ten that keeps lines at least $spacing pixels apart, so zooming out
+     * thins the grid instead of packing more lines into the screen.
+     *
+     * @return array{float, float, float, float}
+     */
+    private function layout(): array
     {
-        if (abs($value) < 0.0001) {
-            return '0';
+        if ($this->camera === null) {
+            return [$this->origin->x, $this->origin->y, $this->unitSize, $this->spacing];
+        }
+
+        $zoom = $this->camera->zoom;
+        $origin = $this->camera->origin();
+
+        $minimum = $this->spacing / $zoom;
+        $magnitude = 10 ** floor(log10($minimum));
+        $step = $magnitude * 10;
+
+        foreach ([1, 2, 5] as $factor) {
+            if ($factor * $magnitude >= $minimum) {
+                $step = $factor * $magnitude;
+                break;
+            }
         }
 
-        $formatted = number_format($value, $this->labelPrecision, '.', '');
+        return [$origin->x, $origin->y, $zoom, $step * $zoom];
+    }
+
+    /**
+     * Decimal places needed to print multiples of $step exactly, at least
+     * labelPrecision and at most four more.
+     */
+    private function precision(float $step): int
+    {
+        $precision = $this->labelPrecision;
 
-        if (str_contains($formatted, '.')) {
-            $formatted = rtrim($formatted, '0');
-            $formatted = rtrim($formatted, '.');
+        while ($precision < $this->labelPrecision + 4 && abs(round($step, $precision) - $step) > 1e-9 * max(1.0, $step)) {
+            $precision++;
         }
 
-        return $formatted;
+        return $precision;
     }
 }